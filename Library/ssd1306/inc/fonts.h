@@ -39,6 +39,52 @@ typedef struct
 	const uint16_t *data; /*!< Pointer to data font data array */
 } FontDef_t;
 
+/**
+ * @brief  Glyph data formats of @ref FontPageDef_t fonts
+ */
+typedef enum
+{
+	FONTS_FORMAT_PAGE = 0, /*!< ((FontHeight + 7) / 8) pages of FontWidth column bytes per glyph, LSB on top */
+	FONTS_FORMAT_PACKED,   /*!< Inked box of each glyph bit-packed column after column, see Tools/fonttool.py */
+	FONTS_FORMAT_RLE       /*!< Page-major glyph bytes run-length encoded, see Tools/rletool.py */
+} FONTS_FORMAT_t;
+
+/**
+ * @brief  Metrics of one glyph of a proportional @ref FontPageDef_t font
+ * @note   Only the inked box of the glyph is stored, blank rows and columns around it are never drawn
+ */
+typedef struct
+{
+	uint16_t Offset;          /*!< Byte offset of the inked box inside data */
+	uint8_t Advance;          /*!< Distance to the next glyph in pixels */
+	uint8_t Left;             /*!< First inked column, relative to the pen position */
+	uint8_t Top;              /*!< First inked row, relative to the top of the line */
+	uint8_t Width;            /*!< Inked box width in pixels, zero for blank glyphs */
+	uint8_t Height;           /*!< Inked box height in pixels */
+} FontGlyphDef_t;
+
+/**
+ * @brief  Page-major font structure
+ * @note   Glyphs are rendered as whole column bytes, the same layout used by the SSD1306 GDDRAM
+ * @note   Proportional fonts store the inked box of every glyph in data, using the page or RLE format.
+ *         FontWidth then holds the widest advance and FontHeight the line height
+ */
+typedef struct
+{
+	uint8_t FontWidth;        /*!< Font width in pixels */
+	uint8_t FontHeight;       /*!< Font height in pixels */
+	uint16_t FirstChar;       /*!< First character (Unicode code point) stored in the font */
+	uint16_t LastChar;        /*!< Last character (Unicode code point) stored in the font */
+	const uint8_t *data;      /*!< Pointer to glyph data array */
+	uint8_t Format;           /*!< Glyph data format. This parameter can be a value of @ref FONTS_FORMAT_t enumeration */
+	const uint16_t *Index;    /*!< Byte offset of every glyph inside data, not used by @ref FONTS_FORMAT_PAGE */
+	const uint16_t *CharMap;  /*!< Sorted characters of a subset font, one per glyph. NULL when every character
+	                               from FirstChar to LastChar is stored */
+	uint16_t GlyphCount;      /*!< Number of glyphs stored in the font */
+	const FontGlyphDef_t *Glyphs; /*!< Metrics of every glyph of a proportional font, NULL for monospace fonts */
+	uint8_t Baseline;         /*!< Rows from the top of the line to the baseline, zero when unknown */
+} FontPageDef_t;
+
 /** 
  * @brief  String length and height 
  */
@@ -50,7 +96,32 @@ typedef struct
 
 
 /* Exported constants --------------------------------------------------------*/
+#define FONTS_FIRST_CHAR      (32)  /*!< First character stored in @ref FontDef_t fonts */
+#define FONTS_LAST_CHAR       (126) /*!< Last character stored in @ref FontDef_t fonts */
+
+/**
+ * @brief  Set to 0 to drop the large @ref FontDef_t tables from fonts.c, when big text is drawn
+ *         with ssd1306_puts_scaled() from a smaller font
+ */
+#ifndef FONTS_USE_11X18
+#define FONTS_USE_11X18       (1)
+#endif
+#ifndef FONTS_USE_16X26
+#define FONTS_USE_16X26       (1)
+#endif
+
 /* Exported macro ------------------------------------------------------------*/
+
+/**
+ * @brief  Number of pages (8 pixel rows) needed by a font height
+ */
+#define FONTS_PAGES(height)   (((height) + 7) / 8)
+
+/**
+ * @brief  Bytes needed to convert a @ref FontDef_t font with @ref FONTS_ConvertToPage
+ */
+#define FONTS_PAGE_DATA_SIZE(width, height)   ((FONTS_LAST_CHAR - FONTS_FIRST_CHAR + 1) * (width) * FONTS_PAGES(height))
+
 /* Exported variables --------------------------------------------------------*/
 
 /**
@@ -58,15 +129,40 @@ typedef struct
  */
 extern FontDef_t Font_7x10;
 
+#if FONTS_USE_11X18
 /**
  * @brief  11 x 18 pixels font size structure 
  */
 extern FontDef_t Font_11x18;
+#endif
 
+#if FONTS_USE_16X26
 /**
  * @brief  16 x 26 pixels font size structure 
  */
 extern FontDef_t Font_16x26;
+#endif
+
+/**
+ * @brief  Bit-packed versions of the fonts above, see fonts_packed.c for flash usage
+ */
+extern FontPageDef_t Font_7x10_Packed;
+extern FontPageDef_t Font_11x18_Packed;
+extern FontPageDef_t Font_16x26_Packed;
+
+/**
+ * @brief  Run-length encoded versions of the fonts above, see fonts_rle.c for flash usage
+ */
+extern FontPageDef_t Font_7x10_Rle;
+extern FontPageDef_t Font_11x18_Rle;
+extern FontPageDef_t Font_16x26_Rle;
+
+/**
+ * @brief  Proportional versions of the fonts above, trimmed to the inked box of every glyph
+ */
+extern FontPageDef_t Font_7x10_Prop;
+extern FontPageDef_t Font_11x18_Prop;
+extern FontPageDef_t Font_16x26_Prop;
 
 /* Exported functions prototypes ---------------------------------------------*/
 
@@ -79,4 +175,51 @@ extern FontDef_t Font_16x26;
  */
 char* FONTS_GetStringSize(char* str, FONTS_SIZE_t* SizeStruct, FontDef_t* Font);
 
+/**
+ * @brief  Converts a row-major @ref FontDef_t font to the page-major format
+ * @param  *Font: Pointer to @ref FontDef_t font to be converted
+ * @param  *data: Pointer to array where glyphs will be stored
+ * @param  size: Size of data array, at least @ref FONTS_PAGE_DATA_SIZE bytes
+ * @param  *PageFont: Pointer to @ref FontPageDef_t structure to be filled
+ * @retval Conversion status:
+ *           - 0: data array is too small
+ *           - > 0: Font converted OK
+ */
+uint8_t FONTS_ConvertToPage(const FontDef_t* Font, uint8_t* data, uint32_t size, FontPageDef_t* PageFont);
+
+/**
+ * @brief  Finds glyph of a character inside a page-major font
+ * @note   Subset fonts are searched with a binary search on CharMap
+ * @param  *Font: Pointer to @ref FontPageDef_t font
+ * @param  ch: Character to look for
+ * @retval Glyph index or -1 when character is not part of the font
+ */
+int32_t FONTS_GetGlyphIndex(const FontPageDef_t* Font, uint16_t ch);
+
+/**
+ * @brief  Gets advance of a glyph
+ * @param  *Font: Pointer to @ref FontPageDef_t font
+ * @param  glyph: Glyph index returned by @ref FONTS_GetGlyphIndex
+ * @retval Distance to the next glyph in pixels
+ */
+uint8_t FONTS_GetGlyphAdvance(const FontPageDef_t* Font, int32_t glyph);
+
+/**
+ * @brief  Calculates width of an UTF-8 string in units of pixels
+ * @note   Measuring stops at the first character that is not part of the font, like @ref ssd1306_puts_page
+ * @param  *str: UTF-8 string to be measured
+ * @param  *Font: Pointer to @ref FontPageDef_t font used for calculations
+ * @retval String width in units of pixels
+ */
+uint16_t FONTS_GetStringWidth(const char* str, const FontPageDef_t* Font);
+
+/**
+ * @brief  Decodes next character of an UTF-8 string
+ * @note   Bytes that are not part of a valid sequence are returned as they are (Latin-1),
+ *         code points above 0xFFFF are returned as 0xFFFD
+ * @param  **str: Pointer to string pointer, advanced past the decoded character
+ * @retval Unicode code point, zero at the end of the string
+ */
+uint16_t FONTS_DecodeUTF8(const char** str);
+
 #endif /* _FONTS_H */
@@ -30,12 +30,120 @@ typedef enum
 	ssd1306_color_white      /*!< Pixel is set. Color depends on LCD */
 } ssd1306_color_t;
 
+typedef enum
+{
+	ssd1306_text_opaque = 0,   /*!< Background pixels of glyphs are drawn with the opposite color */
+	ssd1306_text_transparent   /*!< Only foreground pixels are drawn, the underlying graphics stay visible */
+} ssd1306_text_mode_t;
+
+/**
+ * @brief  Page-major 1bpp drawing surface, laid out like the internal RAM of the LCD
+ */
+typedef struct
+{
+	uint8_t* buffer;      /*!< Page 0 first, one byte per column and page, LSB on top */
+	uint16_t width;       /*!< Width in units of pixels */
+	uint16_t height;      /*!< Height in units of pixels */
+	uint16_t stride;      /*!< Bytes from one page to the next, at least width */
+} ssd1306_canvas_t;
+
+/**
+ * @brief  8x8 fill pattern, repeated over the target from its top left corner
+ */
+typedef struct
+{
+	uint8_t column[8];    /*!< One byte per column, bit n is row n. Same layout as a page of the buffer */
+} ssd1306_pattern_t;
+
+/**
+ * @brief  Rectangle in units of pixels
+ */
+typedef struct
+{
+	int16_t x;            /*!< Top left X location */
+	int16_t y;            /*!< Top left Y location */
+	int16_t w;            /*!< Width, empty when not positive */
+	int16_t h;            /*!< Height, empty when not positive */
+} ssd1306_rect_t;
+
+typedef enum
+{
+	ssd1306_scroll_dir_right = 0, /*!< Content moves one column right per step */
+	ssd1306_scroll_dir_left       /*!< Content moves one column left per step */
+} ssd1306_scroll_direction_t;
+
+typedef enum
+{
+	ssd1306_scroll_frames_2 = 0x07, /*!< One step every 2 frames, the fastest */
+	ssd1306_scroll_frames_3 = 0x04,
+	ssd1306_scroll_frames_4 = 0x05,
+	ssd1306_scroll_frames_5 = 0x00, /*!< Used by @ref ssd1306_scroll_right and the other legacy functions */
+	ssd1306_scroll_frames_25 = 0x06,
+	ssd1306_scroll_frames_64 = 0x01,
+	ssd1306_scroll_frames_128 = 0x02,
+	ssd1306_scroll_frames_256 = 0x03 /*!< One step every 256 frames, the slowest */
+} ssd1306_scroll_speed_t;
+
+typedef enum
+{
+	ssd1306_rotation_0 = 0,   /*!< Native orientation, 128 x 64 */
+	ssd1306_rotation_90,      /*!< Portrait 64 x 128, turned clockwise */
+	ssd1306_rotation_180,     /*!< Upside down 128 x 64, done by the LCD at no cost */
+	ssd1306_rotation_270      /*!< Portrait 64 x 128, turned counterclockwise */
+} ssd1306_rotation_t;
+
+/**
+ * @brief  Hardware scroll settings
+ */
+typedef struct
+{
+	ssd1306_scroll_direction_t direction; /*!< Horizontal direction */
+	ssd1306_scroll_speed_t speed;         /*!< Frames between steps */
+	uint8_t start_page;                   /*!< First page scrolled. Valid input is 0 to 7 */
+	uint8_t end_page;                     /*!< Last page scrolled, not below start_page */
+	uint8_t start_column;                 /*!< First column scrolled, see @ref SSD1306_SCROLL_COLUMNS */
+	uint8_t end_column;                   /*!< Last column scrolled, see @ref SSD1306_SCROLL_COLUMNS */
+	uint8_t vertical_offset;              /*!< Rows moved up per step, 0 for horizontal scroll only */
+} ssd1306_scroll_t;
+
 /* Exported constants --------------------------------------------------------*/
 #define SSD1306_WIDTH       (128)
 #define SSD1306_HEIGHT      (64)
+#define SSD1306_INIT_SEQUENCE_SIZE  (28)
+
+/**
+ * @brief  Set to 0 to drop the 1 KB internal RAM, for the tilemap and page modes.
+ *         Drawing functions then only work on canvases and updates send nothing
+ */
+#ifndef SSD1306_FRAMEBUFFER
+#define SSD1306_FRAMEBUFFER     (1)
+#endif
+
+/**
+ * @brief  Set to 1 when the controller takes a column range for horizontal scroll.
+ *         The original SSD1306 expects dummy bytes there and always scrolls whole pages
+ */
+#ifndef SSD1306_SCROLL_COLUMNS
+#define SSD1306_SCROLL_COLUMNS  (0)
+#endif
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported variables --------------------------------------------------------*/
+
+/**
+ * @brief  Commands sent by @ref ssd1306_init, also used to set up other panels
+ */
+extern const uint8_t ssd1306_init_sequence[SSD1306_INIT_SEQUENCE_SIZE];
+
+/**
+ * @brief  Stipple patterns for @ref ssd1306_set_pattern: 50% checkerboard, diagonal,
+ *         horizontal and vertical lines every 4 pixels
+ */
+extern const ssd1306_pattern_t ssd1306_pattern_checker;
+extern const ssd1306_pattern_t ssd1306_pattern_diagonal;
+extern const ssd1306_pattern_t ssd1306_pattern_horizontal;
+extern const ssd1306_pattern_t ssd1306_pattern_vertical;
+
 /* Exported functions prototypes ---------------------------------------------*/
 
 /**
@@ -55,6 +163,17 @@ uint8_t ssd1306_init(void);
  */
 void ssd1306_update_screen(void);
 
+/**
+ * @brief  Updates part of the buffer from internal RAM to LCD
+ * @note   Only the pages and columns covering the area are sent, use it when a small part of the screen changed
+ * @param  x: Top left X start point
+ * @param  y: Top left Y start point, rounded down to a page boundary
+ * @param  w: Area width in units of pixels
+ * @param  h: Area height in units of pixels, rounded up to a page boundary
+ * @retval None
+ */
+void ssd1306_update_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
 /**
  * @brief  Toggles pixels invertion inside internal RAM
  * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
@@ -89,13 +208,49 @@ void ssd1306_draw_pixel(uint16_t x, uint16_t y, ssd1306_color_t color);
  */
 void ssd1306_goto_xy(uint16_t x, uint16_t y);
 
+/**
+ * @brief  Sets how characters are drawn by the putc and puts functions
+ * @note   Transparent text only touches the set bits of every glyph, ORing white pixels into the buffer
+ *         or clearing black ones, so text can be drawn over bitmaps without redrawing them
+ * @param  mode: Text mode. This parameter can be a value of @ref ssd1306_text_mode_t enumeration
+ * @retval None
+ */
+void ssd1306_set_text_mode(ssd1306_text_mode_t mode);
+
+/**
+ * @brief  Gets how characters are drawn by the putc and puts functions
+ * @param  None
+ * @retval Text mode, a value of @ref ssd1306_text_mode_t enumeration
+ */
+ssd1306_text_mode_t ssd1306_get_text_mode(void);
+
+/**
+ * @brief  Sets the pattern of filled rectangles and filled circles
+ * @note   Set pattern bits are drawn with the color given to the drawing function. Clear bits get the
+ *         opposite color in opaque mode and are left alone in transparent mode, e.g. to shade a disabled
+ *         control. The pattern is applied as one byte mask per column and page, so a patterned fill costs
+ *         about the same as a solid one
+ * @param  *pattern: Pointer to @ref ssd1306_pattern_t structure, it must stay valid while set. NULL for solid fills
+ * @param  mode: How clear pattern bits are drawn. This parameter can be a value of @ref ssd1306_text_mode_t enumeration
+ * @retval None
+ */
+void ssd1306_set_pattern(const ssd1306_pattern_t* pattern, ssd1306_text_mode_t mode);
+
+/**
+ * @brief  Makes an ordered dither gray level from the 8x8 Bayer matrix
+ * @param  *pattern: Pointer to @ref ssd1306_pattern_t structure to be filled
+ * @param  level: Number of set pixels. This parameter can be a value between 0 (black) and 64 (white)
+ * @retval None
+ */
+void ssd1306_pattern_gray(ssd1306_pattern_t* pattern, uint8_t level);
+
 /**
  * @brief  Puts character to internal RAM
  * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
  * @param  ch: Character to be written
  * @param  *Font: Pointer to @ref FontDef_t structure with used font
  * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
- * @retval Character written
+ * @retval Character written, zero when it does not fit or the font is taller than 64 rows
  */
 char ssd1306_putc(char ch, FontDef_t* Font, ssd1306_color_t color);
 
@@ -109,6 +264,89 @@ char ssd1306_putc(char ch, FontDef_t* Font, ssd1306_color_t color);
  */
 char ssd1306_puts(char* str, FontDef_t* Font, ssd1306_color_t color);
 
+/**
+ * @brief  Puts character to internal RAM, scaled by an integer factor
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @note   Column bytes of the glyph are expanded with lookup tables and written as whole bytes,
+ *         so Font_7x10 at scale 2 or 3 can replace the larger fonts
+ * @param  ch: Character to be written
+ * @param  *Font: Pointer to @ref FontDef_t structure with used font
+ * @param  scale: Scale factor, 1 to 4
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Character written, zero when it does not fit, scale is not supported or the font is taller than 64 rows
+ */
+char ssd1306_putc_scaled(char ch, FontDef_t* Font, uint8_t scale, ssd1306_color_t color);
+
+/**
+ * @brief  Puts string to internal RAM, scaled by an integer factor
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  *str: String to be written
+ * @param  *Font: Pointer to @ref FontDef_t structure with used font
+ * @param  scale: Scale factor, 1 to 4
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Zero on success or character value when function failed
+ */
+char ssd1306_puts_scaled(char* str, FontDef_t* Font, uint8_t scale, ssd1306_color_t color);
+
+/**
+ * @brief  Draws page-major column data at desired location
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @note   Data holds ((h + 7) / 8) pages of w column bytes, LSB on top. Whole column bytes are written,
+ *         shifted across two pages when y is not a multiple of 8
+ * @param  x: Top left X start point
+ * @param  y: Top left Y start point
+ * @param  *data: Pointer to page-major column data
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @param  color: Color used for set bits, clear bits are drawn with the opposite color unless
+ *         @ref ssd1306_text_transparent mode is set
+ * @retval None
+ */
+void ssd1306_draw_columns(int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, ssd1306_color_t color);
+
+/**
+ * @brief  Renders UTF-8 string from a page-major font into a page-major bitmap instead of the screen
+ * @note   The bitmap is cleared and glyphs are drawn with set bits from its top left corner,
+ *         ready to be drawn with @ref ssd1306_draw_columns. The cursor of the putc functions is not changed
+ * @param  *data: Pointer to bitmap of ((h + 7) / 8) pages of w column bytes
+ * @param  w: Bitmap width in units of pixels
+ * @param  h: Bitmap height in units of pixels
+ * @param  *str: UTF-8 string to be rendered
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @retval Width of the rendered text in units of pixels
+ */
+uint16_t ssd1306_puts_bitmap(uint8_t* data, uint16_t w, uint16_t h, const char* str, const FontPageDef_t* Font);
+
+/**
+ * @brief  Puts character from a page-major font to internal RAM
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  ch: Character to be written, values above 0x7F are taken as Latin-1
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Character written, zero when it does not fit or is not part of the font
+ */
+char ssd1306_putc_page(char ch, const FontPageDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Puts Unicode character from a page-major font to internal RAM
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  ch: Unicode code point to be written
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Code point written, zero when it does not fit or is not part of the font
+ */
+uint16_t ssd1306_putc_unicode(uint16_t ch, const FontPageDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Puts UTF-8 string from a page-major font to internal RAM
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Zero on success or first byte of the character that failed
+ */
+char ssd1306_puts_page(const char* str, const FontPageDef_t* Font, ssd1306_color_t color);
+
 /**
  * @brief  Draws line on LCD
  * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
@@ -192,6 +430,94 @@ void ssd1306_draw_filled_circle(int16_t x0, int16_t y0, int16_t r, ssd1306_color
  */
 void ssd1306_draw_bitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color);
 
+/**
+ * @brief  Draws a run-length encoded page-major bitmap
+ * @note   The bitmap is decoded straight into internal RAM, no decompression buffer is used.
+ *         Encode bitmaps with Tools/rletool.py. Colors work as in @ref ssd1306_draw_bitmap
+ * @param  X:  X location to start the Drawing
+ * @param  Y:  Y location to start the Drawing
+ * @param  *bitmap : Pointer to the encoded bitmap
+ * @param  W : width of the image
+ * @param  H : Height of the image
+ * @param  color : 1-> white/blue, 0-> black
+ */
+void ssd1306_draw_bitmap_rle(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color);
+
+/**
+ * @brief  Initializes a canvas over a buffer of w * ((h + 7) / 8) bytes
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure to be initialized
+ * @param  *buffer: Pointer to canvas memory, it is not cleared
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_canvas_init(ssd1306_canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h);
+
+/**
+ * @brief  Initializes a canvas sharing memory with a window of another one
+ * @note   Drawing to the view draws to the parent, no memory is copied
+ * @param  *view: Pointer to @ref ssd1306_canvas_t structure to be initialized
+ * @param  *parent: Pointer to @ref ssd1306_canvas_t structure of the parent canvas
+ * @param  x: Left X location of the window in the parent
+ * @param  page: Top page of the window in the parent, views start on whole pages
+ * @param  w: Width in units of pixels, clipped to the parent
+ * @param  h: Height in units of pixels, clipped to the parent
+ * @retval None
+ */
+void ssd1306_canvas_view(ssd1306_canvas_t* view, const ssd1306_canvas_t* parent, uint16_t x, uint16_t page, uint16_t w, uint16_t h);
+
+/**
+ * @brief  Selects the canvas every drawing function writes to
+ * @note   Text, lines, shapes, bitmaps, fill and invert work the same on any canvas.
+ *         The canvas settings are copied, the update and scroll functions always use the screen
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure, NULL selects internal RAM
+ * @retval None
+ */
+void ssd1306_set_canvas(const ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Selects a one page buffer standing for a page of the screen as drawing target
+ * @note   Drawing functions take screen coordinates and only write the rows of that page,
+ *         everything else is clipped. Used to render a frame one page at a time
+ * @param  *buffer: Pointer to SSD1306_WIDTH bytes of page memory
+ * @param  page: Page of the screen held by the buffer. Valid input is 0 to 7
+ * @retval None
+ */
+void ssd1306_set_page_canvas(uint8_t* buffer, uint8_t page);
+
+/**
+ * @brief  Gets the canvas of internal RAM, to copy from or to take views of the screen
+ * @param  None
+ * @retval Pointer to @ref ssd1306_canvas_t structure of the screen
+ */
+const ssd1306_canvas_t* ssd1306_get_screen(void);
+
+/**
+ * @brief  Copies a rectangle from one canvas to another
+ * @note   Rows are moved as whole page bytes, shifted when source and destination rows
+ *         are not aligned. Source and destination must not overlap
+ * @param  *dst: Pointer to destination @ref ssd1306_canvas_t structure, NULL for internal RAM
+ * @param  x: Top left X location in destination
+ * @param  y: Top left Y location in destination
+ * @param  *src: Pointer to source @ref ssd1306_canvas_t structure
+ * @param  sx: Top left X location in source
+ * @param  sy: Top left Y location in source
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_canvas_blit(ssd1306_canvas_t* dst, int16_t x, int16_t y, const ssd1306_canvas_t* src, int16_t sx, int16_t sy, int16_t w, int16_t h);
+
+/**
+ * @brief  Copies a whole canvas to the selected canvas, internal RAM by default
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure to be drawn
+ * @retval None
+ */
+void ssd1306_draw_canvas(int16_t x, int16_t y, const ssd1306_canvas_t* canvas);
+
 /**
  * @brief  Scroll screen to right
  * @retval None
@@ -216,18 +542,102 @@ void ssd1306_scroll_diag_right(uint8_t start_row, uint8_t end_row);
  */
 void ssd1306_scroll_diag_left(uint8_t start_row, uint8_t end_row);
 
+/**
+ * @brief  Starts hardware scroll
+ * @note   Scrolling runs in the controller without any bus traffic. Until it is stopped,
+ *         internal RAM is not sent to the scrolled pages
+ * @param  *scroll: Pointer to @ref ssd1306_scroll_t structure with scroll settings
+ * @retval None
+ */
+void ssd1306_scroll_start(const ssd1306_scroll_t* scroll);
+
+/**
+ * @brief  Stops hardware scroll, knowing how far the content moved
+ * @note   Horizontal scroll moves GDDRAM itself: the scrolled area of internal RAM is rotated
+ *         by the same number of columns, so both match again without sending any byte.
+ *         When an update skipped the scrolled pages, they are rewritten as by @ref ssd1306_stop_scroll.
+ *         The vertical offset is not kept by the controller once scrolling stops
+ * @param  steps: Steps done since @ref ssd1306_scroll_start, frames elapsed divided by
+ *         @ref ssd1306_scroll_get_frames
+ * @retval None
+ */
+void ssd1306_scroll_stop_at(uint32_t steps);
+
+/**
+ * @brief  Gets number of frames between two scroll steps
+ * @param  speed: Scroll speed. This parameter can be a value of @ref ssd1306_scroll_speed_t enumeration
+ * @retval Frames per step
+ */
+uint16_t ssd1306_scroll_get_frames(ssd1306_scroll_speed_t speed);
+
 /**
  * @brief  Stop scroll screen
+ * @note   GDDRAM of the scrolled area is rewritten from internal RAM, the rest of the screen is not sent
  * @retval None
  */
 void ssd1306_stop_scroll(void);
 
+/**
+ * @brief  Scrolls a region of internal RAM by any number of pixels and sends it to the LCD
+ * @note   Columns of the region are moved as 64-bit words, so vertical steps cross pages without
+ *         per-pixel work. Pixels moved out of the region are dropped and the exposed strip is
+ *         filled with black. Only the region is sent, @ref ssd1306_update_screen() is not needed.
+ *         Does nothing while the screen is rotated to portrait
+ * @param  x: Top left X location of the region
+ * @param  y: Top left Y location of the region
+ * @param  w: Region width in units of pixels
+ * @param  h: Region height in units of pixels
+ * @param  dx: Pixels moved right, negative values move left
+ * @param  dy: Pixels moved down, negative values move up
+ * @retval None
+ */
+void ssd1306_scroll_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int16_t dx, int16_t dy);
+
+/**
+ * @brief  Sets the display start line, the GDDRAM row shown on top of the scroll area
+ * @note   Moves the picture without sending any data, see @ref ssd1306_set_vertical_scroll_area
+ * @param  line: Start line. Valid input is 0 to 63
+ * @retval None
+ */
+void ssd1306_set_start_line(uint8_t line);
+
+/**
+ * @brief  Sets the vertical scroll area
+ * @note   Rows above the scroll area stay fixed while the start line moves or the screen scrolls diagonally
+ * @param  fixed: Number of rows on top that do not scroll
+ * @param  rows: Number of rows in the scroll area. fixed + rows must not exceed SSD1306_HEIGHT
+ * @retval None
+ */
+void ssd1306_set_vertical_scroll_area(uint8_t fixed, uint8_t rows);
+
 /**
  * @brief  Invert screen
  * @retval None
  */
 void ssd1306_invert_display(int i);
 
+/**
+ * @brief  Sets the orientation of the screen
+ * @note   0 and 180 degrees only change the segment remap and COM scan direction of the LCD.
+ *         90 and 270 degrees turn internal RAM into a 64 x 128 portrait screen, transposed
+ *         in 8 x 8 pixel blocks by the update functions. Internal RAM is cleared when
+ *         switching between landscape and portrait. Hardware scroll works in landscape only.
+ *         @ref ssd1306_scroll_region, the compositor and sprite list, which build 64-row columns,
+ *         and the console, viewport, tilemap, page mode and column surface, which send landscape
+ *         pages to the LCD, return without drawing in portrait. Panels drive their own LCDs and
+ *         are not affected
+ * @param  rotation: Orientation. This parameter can be a value of @ref ssd1306_rotation_t enumeration
+ * @retval None
+ */
+void ssd1306_set_rotation(ssd1306_rotation_t rotation);
+
+/**
+ * @brief  Gets the orientation of the screen
+ * @param  None
+ * @retval Orientation, a value of @ref ssd1306_rotation_t enumeration
+ */
+ssd1306_rotation_t ssd1306_get_rotation(void);
+
 /**
  * @brief  Clear screen
  * @retval None
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_columns.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_COLUMNS_H
+#define _SSD1306_COLUMNS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Bytes of page data converted per bus transfer, taken from the stack
+ */
+#ifndef SSD1306_COLUMNS_CHUNK
+#define SSD1306_COLUMNS_CHUNK       (32)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Screen stored column-major, one 64-bit word per column, bit 0 on top
+ * @note   Vertical moves, spans and flips are one shift or mask per column.
+ *         Converted to page bytes only while being sent to the LCD
+ */
+typedef struct
+{
+	uint64_t column[SSD1306_WIDTH];  /*!< Pixels of every column, bit n is row n */
+} ssd1306_columns_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Fills the whole surface with one color
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  color: Fill color. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval None
+ */
+void ssd1306_columns_fill(ssd1306_columns_t* cols, ssd1306_color_t color);
+
+/**
+ * @brief  Draws pixel at desired location
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: X location. This parameter can be a value between 0 and SSD1306_WIDTH - 1
+ * @param  y: Y location. This parameter can be a value between 0 and SSD1306_HEIGHT - 1
+ * @param  color: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval None
+ */
+void ssd1306_columns_pixel(ssd1306_columns_t* cols, uint16_t x, uint16_t y, ssd1306_color_t color);
+
+/**
+ * @brief  Draws a vertical span, one mask operation
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: X location. This parameter can be a value between 0 and SSD1306_WIDTH - 1
+ * @param  y0: First row, in either order with y1. Rows outside the screen are clipped
+ * @param  y1: Last row
+ * @param  color: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval None
+ */
+void ssd1306_columns_span(ssd1306_columns_t* cols, uint16_t x, int16_t y0, int16_t y1, ssd1306_color_t color);
+
+/**
+ * @brief  Moves the columns x to x + w - 1 by whole pixels, vacated pixels get the background color
+ * @note   A vertical move is one shift per column, a horizontal move one memmove
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: Left column of the region
+ * @param  w: Region width in units of pixels
+ * @param  dx: Pixels moved right, negative values move left
+ * @param  dy: Pixels moved down, negative values move up
+ * @param  background: Color of vacated pixels. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval None
+ */
+void ssd1306_columns_scroll(ssd1306_columns_t* cols, uint16_t x, uint16_t w, int16_t dx, int16_t dy, ssd1306_color_t background);
+
+/**
+ * @brief  Mirrors the columns x to x + w - 1 top to bottom
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: Left column of the region
+ * @param  w: Region width in units of pixels
+ * @retval None
+ */
+void ssd1306_columns_flip(ssd1306_columns_t* cols, uint16_t x, uint16_t w);
+
+/**
+ * @brief  Copies a page-major canvas, e.g. text drawn with the usual functions
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure, at most 64 pixels high
+ * @retval None
+ */
+void ssd1306_columns_blit(ssd1306_columns_t* cols, int16_t x, int16_t y, const ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Converts the surface to page-major bytes, e.g. into internal RAM
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure of at least SSD1306_WIDTH x SSD1306_HEIGHT
+ * @retval None
+ */
+void ssd1306_columns_store(const ssd1306_columns_t* cols, ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Sends the columns x to x + w - 1 to the LCD, converted to page bytes on the way
+ * @note   Internal RAM is not used. Does nothing while the screen is rotated to portrait
+ * @param  *cols: Pointer to @ref ssd1306_columns_t structure
+ * @param  x: Left column
+ * @param  w: Width in units of pixels
+ * @retval None
+ */
+void ssd1306_columns_update(const ssd1306_columns_t* cols, uint16_t x, uint16_t w);
+
+#endif /* _SSD1306_COLUMNS_H */
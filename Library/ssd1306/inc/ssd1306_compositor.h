@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_compositor.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_COMPOSITOR_H
+#define _SSD1306_COMPOSITOR_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of layers of a compositor
+ */
+#ifndef SSD1306_COMPOSITOR_LAYERS
+#define SSD1306_COMPOSITOR_LAYERS   (4)
+#endif
+
+/**
+ * @brief  Maximum number of damaged rectangles kept between two presents, more are merged
+ */
+#ifndef SSD1306_COMPOSITOR_DAMAGE
+#define SSD1306_COMPOSITOR_DAMAGE   (8)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  1bpp layer placed on the screen
+ */
+typedef struct
+{
+	ssd1306_canvas_t canvas;    /*!< Layer pixels, drawn with @ref ssd1306_set_canvas */
+	const uint8_t* mask;        /*!< Set bits mark the pixels covering the layers below, laid out
+	                                 like canvas. NULL covers the whole layer, the canvas buffer
+	                                 itself draws only the set pixels */
+	int16_t x;                  /*!< Screen X location of the layer */
+	int16_t y;                  /*!< Screen Y location of the layer */
+	uint8_t visible;            /*!< Zero when the layer is hidden */
+} ssd1306_layer_t;
+
+/**
+ * @brief  Stack of layers composited into internal RAM
+ */
+typedef struct
+{
+	ssd1306_layer_t* layers[SSD1306_COMPOSITOR_LAYERS]; /*!< Bottom layer first */
+	uint8_t count;                                      /*!< Number of layers */
+	ssd1306_rect_t damage[SSD1306_COMPOSITOR_DAMAGE];   /*!< Screen areas to composite */
+	uint8_t damaged;                                    /*!< Number of damaged areas */
+} ssd1306_compositor_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a compositor without layers
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @retval None
+ */
+void ssd1306_compositor_init(ssd1306_compositor_t* comp);
+
+/**
+ * @brief  Initializes a visible layer at the top left corner of the screen
+ * @param  *layer: Pointer to @ref ssd1306_layer_t structure
+ * @param  *buffer: Pointer to layer memory of w * ((h + 7) / 8) bytes
+ * @param  *mask: Pointer to mask laid out like buffer, NULL for an opaque layer
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_layer_init(ssd1306_layer_t* layer, uint8_t* buffer, const uint8_t* mask, uint16_t w, uint16_t h);
+
+/**
+ * @brief  Puts a layer on top of the others
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @param  *layer: Pointer to @ref ssd1306_layer_t structure, it must stay valid while used
+ * @retval 1 when added, 0 when the compositor is full
+ */
+uint8_t ssd1306_compositor_add(ssd1306_compositor_t* comp, ssd1306_layer_t* layer);
+
+/**
+ * @brief  Marks a screen area to be composited again
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_compositor_damage(ssd1306_compositor_t* comp, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Marks an area of a layer that was drawn, in layer coordinates
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @param  *layer: Pointer to @ref ssd1306_layer_t structure
+ * @param  x: Top left X location in the layer
+ * @param  y: Top left Y location in the layer
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_layer_damage(ssd1306_compositor_t* comp, const ssd1306_layer_t* layer, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Moves a layer, both the old and the new area are damaged
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @param  *layer: Pointer to @ref ssd1306_layer_t structure
+ * @param  x: Screen X location
+ * @param  y: Screen Y location
+ * @retval None
+ */
+void ssd1306_layer_move(ssd1306_compositor_t* comp, ssd1306_layer_t* layer, int16_t x, int16_t y);
+
+/**
+ * @brief  Shows or hides a layer
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @param  *layer: Pointer to @ref ssd1306_layer_t structure
+ * @param  visible: 0 hides the layer
+ * @retval None
+ */
+void ssd1306_layer_show(ssd1306_compositor_t* comp, ssd1306_layer_t* layer, uint8_t visible);
+
+/**
+ * @brief  Composites the damaged areas into internal RAM and sends them to the LCD
+ * @note   Screen columns are built as 64-bit words, each layer is applied with one AND and
+ *         one OR per column whatever its Y location. Areas not damaged are neither
+ *         composited nor sent, @ref ssd1306_update_screen() is not needed. Nothing is done
+ *         while the screen is rotated to portrait
+ * @param  *comp: Pointer to @ref ssd1306_compositor_t structure
+ * @retval Number of areas sent
+ */
+uint8_t ssd1306_compositor_present(ssd1306_compositor_t* comp);
+
+#endif /* _SSD1306_COMPOSITOR_H */
@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_console.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_CONSOLE_H
+#define _SSD1306_CONSOLE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Starts a text console below a fixed header
+ * @note   Lines are scrolled by the display start line, so a new line only sends its own pages
+ *         instead of the whole screen. Each line takes (FontHeight + 7) / 8 pages, pages left
+ *         below the last line stay fixed like the header.
+ * @note   While the console is open internal RAM holds the GDDRAM layout: the header is drawn
+ *         with the usual functions in its rows, console rows must only be written by the console.
+ *         Console functions do nothing while the screen is rotated to portrait
+ * @param  header: Number of pages on top that do not scroll. Valid input is 0 to 7
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Text color, the background uses the opposite color
+ * @retval 1 when the console was started, 0 when no line fits below the header or the screen is portrait
+ */
+uint8_t ssd1306_console_init(uint8_t header, const FontPageDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Writes UTF-8 string to the console
+ * @note   Changed columns are sent to the LCD right away, @ref ssd1306_update_screen() is not needed.
+ *         '\n' starts a new line, '\r' returns to the start of the line and text wider than the
+ *         screen is wrapped. A new line on the last one scrolls the console by one line
+ * @param  *str: UTF-8 string to be written
+ * @retval None
+ */
+void ssd1306_console_puts(const char* str);
+
+/**
+ * @brief  Clears the console lines, the header is kept
+ * @param  None
+ * @retval None
+ */
+void ssd1306_console_clear(void);
+
+/**
+ * @brief  Stops the console and restores start line and scroll area
+ * @note   Internal RAM is left as is, the screen has to be redrawn
+ * @param  None
+ * @retval None
+ */
+void ssd1306_console_close(void);
+
+#endif /* _SSD1306_CONSOLE_H */
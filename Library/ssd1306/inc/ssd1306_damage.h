@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_damage.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_DAMAGE_H
+#define _SSD1306_DAMAGE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Adds a screen area to a damage list, used by the compositor and the sprite list
+ * @note   The area is clipped to the landscape screen. Overlapping or touching areas are joined,
+ *         and when the list is full the area is joined with the one that grows the least
+ * @param  *list: Pointer to the damaged areas
+ * @param  *count: Pointer to the number of damaged areas
+ * @param  size: Maximum number of damaged areas of the list
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_damage_add(ssd1306_rect_t* list, uint8_t* count, uint8_t size, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Screen rows y to y + h - 1 as bits of a 64-bit column, clipped to the screen
+ * @param  y: First row
+ * @param  h: Number of rows
+ * @retval Row bits, bit n is row n
+ */
+uint64_t ssd1306_damage_rows(int16_t y, int16_t h);
+
+/**
+ * @brief  Gathers 64 rows of a page-major column into one word
+ * @param  *data: Pointer to page-major bytes
+ * @param  stride: Bytes from one page to the next
+ * @param  height: Height of data in units of pixels
+ * @param  x: Column
+ * @param  top: Row of data moved to bit 0, may be negative
+ * @retval Column bits, rows outside data are zero
+ */
+uint64_t ssd1306_damage_column(const uint8_t* data, uint16_t stride, uint16_t height, int16_t x, int16_t top);
+
+/**
+ * @brief  Puts a column of a masked bitmap over a screen column, one AND and one OR
+ * @param  column: Screen column built so far
+ * @param  covered: Screen rows covered by the bitmap
+ * @param  *data: Pointer to page-major bitmap
+ * @param  *mask: Pointer to page-major mask laid out like data, NULL covers every pixel
+ * @param  stride: Bytes from one page to the next
+ * @param  height: Height of data in units of pixels
+ * @param  x: Column of the bitmap
+ * @param  top: Row of the bitmap on screen row 0, i.e. minus its Y location
+ * @retval New screen column
+ */
+uint64_t ssd1306_damage_blend(uint64_t column, uint64_t covered, const uint8_t* data, const uint8_t* mask,
+		uint16_t stride, uint16_t height, int16_t x, int16_t top);
+
+/**
+ * @brief  Writes the rows of a damaged area of one composited column back to internal RAM
+ * @param  *rect: Pointer to the damaged area
+ * @param  x: Screen column
+ * @param  column: Composited column
+ * @retval None
+ */
+void ssd1306_damage_store(const ssd1306_rect_t* rect, int16_t x, uint64_t column);
+
+#endif /* _SSD1306_DAMAGE_H */
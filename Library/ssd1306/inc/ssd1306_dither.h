@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_dither.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_DITHER_H
+#define _SSD1306_DITHER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Set to 0 to build the ordered dither without SSE2/AVX2 kernels on x86 hosts.
+ *         Other targets always use the portable code
+ */
+#ifndef SSD1306_DITHER_SIMD
+#define SSD1306_DITHER_SIMD         (1)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+
+/**
+ * @brief  Entries of the error buffer of the error diffusion functions for an image w pixels wide
+ */
+#define SSD1306_DITHER_ERRORS(w)    (3 * ((w) + 4))
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Converts 8-bit grayscale to 1bpp with the 8x8 Bayer matrix
+ * @note   The image goes to the top left corner of the canvas and is clipped to it, rows below
+ *         the image in its last page are kept. Use @ref ssd1306_canvas_view to place it elsewhere,
+ *         or @ref ssd1306_get_screen to write internal RAM. Every output byte only depends on its
+ *         own 8 pixels, so 16 or 32 columns are converted at once on SSE2 and AVX2 hosts
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure
+ * @param  *gray: Pointer to grayscale pixels, one byte each, 0 black and 255 white
+ * @param  w: Image width in units of pixels
+ * @param  h: Image height in units of pixels
+ * @param  pitch: Bytes from one image row to the next, at least w
+ * @retval None
+ */
+void ssd1306_dither_ordered(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch);
+
+/**
+ * @brief  Converts 8-bit grayscale to 1bpp with Floyd-Steinberg error diffusion
+ * @note   Placement and clipping as @ref ssd1306_dither_ordered. The whole error of every
+ *         pixel goes to its 4 neighbours, which keeps gradients smooth
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure
+ * @param  *gray: Pointer to grayscale pixels, one byte each, 0 black and 255 white
+ * @param  w: Image width in units of pixels
+ * @param  h: Image height in units of pixels
+ * @param  pitch: Bytes from one image row to the next, at least w
+ * @param  *errors: Pointer to SSD1306_DITHER_ERRORS(w) work entries
+ * @retval None
+ */
+void ssd1306_dither_floyd(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch, int16_t* errors);
+
+/**
+ * @brief  Converts 8-bit grayscale to 1bpp with Atkinson error diffusion
+ * @note   Placement and clipping as @ref ssd1306_dither_ordered. Only 3/4 of the error is spread
+ *         over 6 neighbours, so highlights and shadows stay clean, which suits small screens
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure
+ * @param  *gray: Pointer to grayscale pixels, one byte each, 0 black and 255 white
+ * @param  w: Image width in units of pixels
+ * @param  h: Image height in units of pixels
+ * @param  pitch: Bytes from one image row to the next, at least w
+ * @param  *errors: Pointer to SSD1306_DITHER_ERRORS(w) work entries
+ * @retval None
+ */
+void ssd1306_dither_atkinson(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch, int16_t* errors);
+
+#endif /* _SSD1306_DITHER_H */
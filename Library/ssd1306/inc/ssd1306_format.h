@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_format.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_FORMAT_H
+#define _SSD1306_FORMAT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Buffer size that holds any formatted 32 bit number: sign, 10 digits, decimal point and terminator
+ */
+#define SSD1306_FORMAT_SIZE     (13)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Formats an unsigned integer without printf
+ * @param  *buf: Pointer to buffer of at least @ref SSD1306_FORMAT_SIZE bytes, or width + 1 when wider
+ * @param  value: Value to be formatted
+ * @param  width: Minimum number of characters, the number is right aligned. Zero for no padding
+ * @param  pad: Padding character, usually ' ' or '0'
+ * @retval Length of the string written to buf
+ */
+uint8_t ssd1306_format_uint(char* buf, uint32_t value, uint8_t width, char pad);
+
+/**
+ * @brief  Formats a signed integer without printf
+ * @note   With '0' padding the sign is written before the zeros, as "-0042"
+ * @param  *buf: Pointer to buffer of at least @ref SSD1306_FORMAT_SIZE bytes, or width + 1 when wider
+ * @param  value: Value to be formatted
+ * @param  width: Minimum number of characters, the number is right aligned. Zero for no padding
+ * @param  pad: Padding character, usually ' ' or '0'
+ * @retval Length of the string written to buf
+ */
+uint8_t ssd1306_format_int(char* buf, int32_t value, uint8_t width, char pad);
+
+/**
+ * @brief  Formats a fixed-point number without printf or floating point
+ * @note   The value is scaled by 10^decimals, so 2153 with 2 decimals is written as "21.53"
+ *         and -5 with 1 decimal as "-0.5"
+ * @param  *buf: Pointer to buffer of at least @ref SSD1306_FORMAT_SIZE bytes, or width + 1 when wider
+ * @param  value: Scaled value to be formatted
+ * @param  decimals: Number of digits after the decimal point, 0 to 9
+ * @param  width: Minimum number of characters, the number is right aligned. Zero for no padding
+ * @param  pad: Padding character, usually ' ' or '0'
+ * @retval Length of the string written to buf
+ */
+uint8_t ssd1306_format_fixed(char* buf, int32_t value, uint8_t decimals, uint8_t width, char pad);
+
+#endif /* _SSD1306_FORMAT_H */
@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_label.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_LABEL_H
+#define _SSD1306_LABEL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of labels held by the cache
+ */
+#ifndef SSD1306_LABEL_ENTRIES
+#define SSD1306_LABEL_ENTRIES   (16)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Label cache statistics
+ */
+typedef struct
+{
+	uint32_t hits;          /*!< Labels drawn from the cache */
+	uint32_t misses;        /*!< Labels that had to be rendered */
+	uint32_t evictions;     /*!< Labels dropped to make room for new ones */
+	uint8_t hit_rate;       /*!< Hits in percent of all draws */
+	uint8_t entries;        /*!< Labels in the cache */
+	uint16_t used;          /*!< Bytes of the memory budget in use */
+	uint16_t size;          /*!< Memory budget in bytes */
+} ssd1306_label_stats_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes the label cache with a memory budget
+ * @note   Labels are stored as page-major bitmaps followed by their string, so a 7x10 label
+ *         of 8 characters takes about 2 * 56 + 9 bytes
+ * @param  *memory: Pointer to memory used by the cache, NULL disables caching
+ * @param  size: Size of memory in bytes
+ * @retval None
+ */
+void ssd1306_label_init(uint8_t* memory, uint16_t size);
+
+/**
+ * @brief  Puts UTF-8 string to internal RAM, from the cache when it was drawn before
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @note   Labels are keyed by string and font and cached as glyph bits, so color, inversion and
+ *         text mode are applied when drawing and a label drawn in both colors is stored once.
+ *         The least recently used labels are dropped when the budget is full
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval Label width in units of pixels
+ */
+uint16_t ssd1306_label_draw(int16_t x, int16_t y, const char* str, const FontPageDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Drops every label of the cache, statistics are kept
+ * @param  None
+ * @retval None
+ */
+void ssd1306_label_clear(void);
+
+/**
+ * @brief  Gets label cache statistics
+ * @param  *stats: Pointer to @ref ssd1306_label_stats_t structure to be filled
+ * @retval None
+ */
+void ssd1306_label_get_stats(ssd1306_label_stats_t* stats);
+
+#endif /* _SSD1306_LABEL_H */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_layout.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_LAYOUT_H
+#define _SSD1306_LAYOUT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of lines of a layout
+ */
+#ifndef SSD1306_LAYOUT_LINES
+#define SSD1306_LAYOUT_LINES    (8)
+#endif
+
+/**
+ * @brief  Bytes kept from the laid out string, with its terminator, to skip unchanged strings.
+ *         Longer strings are measured on every call
+ */
+#ifndef SSD1306_LAYOUT_TEXT
+#define SSD1306_LAYOUT_TEXT     (64)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+	ssd1306_align_left = 0, /*!< Lines start at the left edge of the box */
+	ssd1306_align_center,   /*!< Lines are centered in the box */
+	ssd1306_align_right     /*!< Lines end at the right edge of the box */
+} ssd1306_align_t;
+
+/**
+ * @brief  One line of a layout
+ */
+typedef struct
+{
+	uint16_t offset;        /*!< Byte offset of the first character of the line inside the string */
+	uint16_t length;        /*!< Bytes of the line, spaces around it are not included */
+	int16_t x;              /*!< Left X location of the line */
+	int16_t y;              /*!< Top Y location of the line */
+	uint16_t width;         /*!< Line width in units of pixels */
+} ssd1306_layout_line_t;
+
+/**
+ * @brief  Box and font the lines of a layout were measured for
+ */
+typedef struct
+{
+	const FontPageDef_t *Font;
+	int16_t x;
+	int16_t y;
+	uint16_t w;
+	uint16_t h;
+	ssd1306_align_t align;
+	uint8_t spacing;
+} ssd1306_layout_key_t;
+
+/**
+ * @brief  Text laid out in a box, filled by @ref ssd1306_layout_text
+ */
+typedef struct
+{
+	const FontPageDef_t *Font; /*!< Font used for measurement and drawing */
+	int16_t x;              /*!< Top left X location of the box */
+	int16_t y;              /*!< Top left Y location of the box */
+	uint16_t w;             /*!< Box width in units of pixels */
+	uint16_t h;             /*!< Box height in units of pixels */
+	ssd1306_align_t align;  /*!< Horizontal alignment of every line */
+	uint8_t spacing;        /*!< Blank rows between lines */
+	const char *str;        /*!< Laid out string */
+	uint8_t valid;          /*!< Not zero when key and text hold the laid out string */
+	ssd1306_layout_key_t key; /*!< Box and font of the laid out string */
+	char text[SSD1306_LAYOUT_TEXT]; /*!< Copy of the laid out string */
+	uint8_t truncated;      /*!< Not zero when the text did not fit in the box */
+	uint8_t count;          /*!< Number of lines */
+	uint16_t width;         /*!< Width of the widest line in units of pixels */
+	uint16_t height;        /*!< Height of all lines in units of pixels */
+	ssd1306_layout_line_t lines[SSD1306_LAYOUT_LINES]; /*!< Lines, from top to bottom */
+} ssd1306_layout_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a layout box
+ * @param  *layout: Pointer to @ref ssd1306_layout_t structure
+ * @param  x: Top left X location of the box
+ * @param  y: Top left Y location of the box
+ * @param  w: Box width in units of pixels
+ * @param  h: Box height in units of pixels
+ * @param  *Font: Pointer to @ref FontPageDef_t font
+ * @param  align: Horizontal alignment. This parameter can be a value of @ref ssd1306_align_t enumeration
+ * @retval None
+ */
+void ssd1306_layout_init(ssd1306_layout_t* layout, int16_t x, int16_t y, uint16_t w, uint16_t h,
+		const FontPageDef_t* Font, ssd1306_align_t align);
+
+/**
+ * @brief  Measures, word-wraps and aligns an UTF-8 string in the box, without drawing it
+ * @note   Lines break at spaces and '\n'. Words wider than the box break between characters.
+ *         Lines that do not fit in the box height are dropped and truncated is set
+ * @note   Laying out the same string again is skipped: the pointer, box, font, alignment and spacing
+ *         must match and the string must equal the copy kept in the layout. Anything else is measured
+ *         again. The string must stay valid and unchanged until @ref ssd1306_layout_draw
+ * @param  *layout: Pointer to @ref ssd1306_layout_t structure
+ * @param  *str: UTF-8 string, characters that are not part of the font are skipped
+ * @retval Number of lines
+ */
+uint8_t ssd1306_layout_text(ssd1306_layout_t* layout, const char* str);
+
+/**
+ * @brief  Draws the lines of a layout to internal RAM
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see updated LCD screen
+ * @param  *layout: Pointer to @ref ssd1306_layout_t structure filled by @ref ssd1306_layout_text
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval None
+ */
+void ssd1306_layout_draw(const ssd1306_layout_t* layout, ssd1306_color_t color);
+
+#endif /* _SSD1306_LAYOUT_H */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_pagemode.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_PAGEMODE_H
+#define _SSD1306_PAGEMODE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Page buffers of SSD1306_WIDTH bytes. Set to 2 when the bus transfer is
+ *         asynchronous, so the next page is drawn while the previous one is sent
+ */
+#ifndef SSD1306_PAGEMODE_BUFFERS
+#define SSD1306_PAGEMODE_BUFFERS    (1)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Frame recorded as a display list and drawn one page at a time
+ */
+typedef struct
+{
+	uint8_t* list;                                          /*!< Display list memory, provided by the application */
+	uint16_t size;                                          /*!< Bytes of display list memory */
+	uint16_t used;                                          /*!< Bytes recorded since @ref ssd1306_pagemode_begin */
+	uint8_t overflow;                                       /*!< A command did not fit, the frame is incomplete */
+	uint8_t page[SSD1306_PAGEMODE_BUFFERS][SSD1306_WIDTH];  /*!< Page being drawn */
+} ssd1306_pagemode_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes page mode over display list memory
+ * @note   Commands take 4 to 16 bytes, plus a pointer for assets and fonts
+ *         and the characters of text
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  *list: Pointer to display list memory
+ * @param  size: Bytes of display list memory
+ * @retval None
+ */
+void ssd1306_pagemode_init(ssd1306_pagemode_t* pm, uint8_t* list, uint16_t size);
+
+/**
+ * @brief  Starts recording a new frame, the display list is emptied
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @retval None
+ */
+void ssd1306_pagemode_begin(ssd1306_pagemode_t* pm);
+
+/**
+ * @brief  Draws the recorded frame and sends it to the LCD
+ * @note   Each page starts black and the whole display list is played into it,
+ *         commands not crossing the page are skipped. Each page is sent as soon
+ *         as it is done. The screen is selected as drawing target afterwards.
+ *         Does nothing while the screen is rotated to portrait
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @retval None
+ */
+void ssd1306_pagemode_render(ssd1306_pagemode_t* pm);
+
+/**
+ * @brief  Records @ref ssd1306_fill
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  color: Color to be used for screen fill. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_fill(ssd1306_pagemode_t* pm, ssd1306_color_t color);
+
+/**
+ * @brief  Records @ref ssd1306_set_text_mode for the commands that follow
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  mode: Text mode. This parameter can be a value of @ref ssd1306_text_mode_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_text_mode(ssd1306_pagemode_t* pm, ssd1306_text_mode_t mode);
+
+/**
+ * @brief  Records @ref ssd1306_draw_pixel
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: X location. This parameter can be a value between 0 and SSD1306_WIDTH - 1
+ * @param  y: Y location. This parameter can be a value between 0 and SSD1306_HEIGHT - 1
+ * @param  color: Color to be used for screen fill. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_pixel(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, ssd1306_color_t color);
+
+/**
+ * @brief  Records @ref ssd1306_draw_line
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x0: Line X start point. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y0: Line Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x1: Line X end point. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y1: Line Y end point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  c: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_line(ssd1306_pagemode_t* pm, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ssd1306_color_t c);
+
+/**
+ * @brief  Records @ref ssd1306_draw_rectangle
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: Top left X start point. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y: Top left Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  w: Rectangle width in units of pixels
+ * @param  h: Rectangle height in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_rectangle(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c);
+
+/**
+ * @brief  Records @ref ssd1306_draw_filled_rectangle
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: Top left X start point. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y: Top left Y start point. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  w: Rectangle width in units of pixels
+ * @param  h: Rectangle height in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_filled_rectangle(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c);
+
+/**
+ * @brief  Records @ref ssd1306_draw_triangle
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x1: First coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y1: First coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x2: Second coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y2: Second coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  x3: Third coordinate X location. Valid input is 0 to SSD1306_WIDTH - 1
+ * @param  y3: Third coordinate Y location. Valid input is 0 to SSD1306_HEIGHT - 1
+ * @param  color: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_triangle(ssd1306_pagemode_t* pm, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, ssd1306_color_t color);
+
+/**
+ * @brief  Records @ref ssd1306_draw_circle
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x0: X location for center of circle
+ * @param  y0: Y location for center of circle
+ * @param  r: Circle radius in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_circle(ssd1306_pagemode_t* pm, int16_t x0, int16_t y0, int16_t r, ssd1306_color_t c);
+
+/**
+ * @brief  Records @ref ssd1306_draw_filled_circle
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x0: X location for center of circle
+ * @param  y0: Y location for center of circle
+ * @param  r: Circle radius in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_filled_circle(ssd1306_pagemode_t* pm, int16_t x0, int16_t y0, int16_t r, ssd1306_color_t c);
+
+/**
+ * @brief  Records @ref ssd1306_draw_bitmap
+ * @note   Only the pointer is recorded, the bitmap must stay valid until the frame is rendered
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *bitmap: Pointer to the bitmap
+ * @param  w: Width of the image
+ * @param  h: Height of the image
+ * @param  color: 1-> white/blue, 0-> black
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_bitmap(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color);
+
+/**
+ * @brief  Records @ref ssd1306_draw_columns
+ * @note   Only the pointer is recorded, the data must stay valid until the frame is rendered
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *data: Pointer to page-major column bytes
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @param  color: Color of set bits. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_columns(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, ssd1306_color_t color);
+
+/**
+ * @brief  Records @ref ssd1306_draw_canvas
+ * @note   Only the pointer is recorded, the canvas must stay valid until the frame is rendered
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure to be drawn
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_canvas(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Records @ref ssd1306_goto_xy and @ref ssd1306_puts
+ * @note   The string is copied to the display list
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: X location of the string
+ * @param  y: Y location of the string
+ * @param  *str: String to be written
+ * @param  *Font: Pointer to @ref FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_puts(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, const char* str, FontDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Records @ref ssd1306_goto_xy and @ref ssd1306_puts_page
+ * @note   The string is copied to the display list
+ * @param  *pm: Pointer to @ref ssd1306_pagemode_t structure
+ * @param  x: X location of the string
+ * @param  y: Y location of the string
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref FontPageDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref ssd1306_color_t enumeration
+ * @retval 1 when recorded, 0 when the display list is full
+ */
+uint8_t ssd1306_pagemode_puts_page(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, const char* str, const FontPageDef_t* Font, ssd1306_color_t color);
+
+#endif /* _SSD1306_PAGEMODE_H */
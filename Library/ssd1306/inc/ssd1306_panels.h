@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_panels.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_PANELS_H
+#define _SSD1306_PANELS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of panels of a logical display
+ */
+#ifndef SSD1306_PANELS_MAX
+#define SSD1306_PANELS_MAX          (4)
+#endif
+
+#define SSD1306_PANEL_PAGES         (SSD1306_HEIGHT / 8)
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Bus access of one panel, so panels can sit on different ports and addresses
+ */
+typedef struct
+{
+	void* bus;            /*!< Bus handle given back to the functions, e.g. an I2C port */
+	uint8_t address;      /*!< Slave address of the panel on its bus */
+	/**
+	 * @brief  Writes commands (reg 0x00) or display data (reg 0x40).
+	 *         It may return before the transfer ends, but must wait for the
+	 *         previous transfer on the same bus before starting a new one
+	 */
+	void (*write)(void* bus, uint8_t address, uint8_t reg, const uint8_t* data, uint16_t count);
+	/**
+	 * @brief  Waits for the transfers of a bus to end, NULL when write blocks
+	 */
+	void (*wait)(void* bus);
+} ssd1306_transport_t;
+
+/**
+ * @brief  One LCD of a logical display
+ */
+typedef struct
+{
+	ssd1306_transport_t transport;            /*!< Bus access */
+	int16_t x;                                /*!< Left column of the panel in the logical canvas */
+	uint8_t page;                             /*!< Top page of the panel in the logical canvas */
+	uint8_t first[SSD1306_PANEL_PAGES];       /*!< First dirty column of each page, none when past last */
+	uint8_t last[SSD1306_PANEL_PAGES];        /*!< Last dirty column of each page */
+	uint8_t command[3];                       /*!< Address setup of the last transfer, kept for async buses */
+} ssd1306_panel_t;
+
+/**
+ * @brief  Logical display made of several LCDs
+ */
+typedef struct
+{
+	ssd1306_canvas_t canvas;                  /*!< Logical surface, drawn after @ref ssd1306_set_canvas */
+	ssd1306_panel_t panels[SSD1306_PANELS_MAX]; /*!< Panels, in the order they were added */
+	uint8_t count;                            /*!< Number of panels */
+} ssd1306_panels_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a logical display over a buffer of w * ((h + 7) / 8) bytes
+ * @note   The buffer is cleared. Select the canvas with ssd1306_set_canvas(&display->canvas)
+ *         to draw across every panel at once
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @param  *buffer: Pointer to logical surface memory
+ * @param  w: Width in units of pixels, e.g. 256 for two panels side by side
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_panels_init(ssd1306_panels_t* display, uint8_t* buffer, uint16_t w, uint16_t h);
+
+/**
+ * @brief  Adds a panel showing a window of the logical surface, and initializes its LCD
+ * @note   @ref ssd1306_init_sequence is sent, then the whole panel is dirty
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @param  *transport: Pointer to @ref ssd1306_transport_t structure, it is copied
+ * @param  x: Left column of the panel in the logical surface
+ * @param  page: Top page of the panel in the logical surface
+ * @retval 1 when added, 0 when the display is full or the panel does not fit the surface
+ */
+uint8_t ssd1306_panels_add(ssd1306_panels_t* display, const ssd1306_transport_t* transport, int16_t x, uint8_t page);
+
+/**
+ * @brief  Sends commands to every panel, e.g. contrast or inversion
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @param  *commands: Pointer to commands, they must stay valid until the next flush on async buses
+ * @param  count: Number of command bytes
+ * @retval None
+ */
+void ssd1306_panels_command(ssd1306_panels_t* display, const uint8_t* commands, uint16_t count);
+
+/**
+ * @brief  Marks a rectangle of the logical surface to be sent by the next flush
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_panels_damage(ssd1306_panels_t* display, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Marks every panel to be sent whole by the next flush
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @retval None
+ */
+void ssd1306_panels_invalidate(ssd1306_panels_t* display);
+
+/**
+ * @brief  Sends the dirty windows of every panel
+ * @note   Pages go out in turns, page 0 of every panel first, so panels on separate
+ *         async buses are written in parallel. Returns after every bus is done
+ * @param  *display: Pointer to @ref ssd1306_panels_t structure
+ * @retval Number of display data bytes sent
+ */
+uint32_t ssd1306_panels_flush(ssd1306_panels_t* display);
+
+#endif /* _SSD1306_PANELS_H */
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_sprite.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_SPRITE_H
+#define _SSD1306_SPRITE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of sprites of a list
+ */
+#ifndef SSD1306_SPRITES
+#define SSD1306_SPRITES     (8)
+#endif
+
+/**
+ * @brief  Maximum number of damaged rectangles kept between two updates, more are merged
+ */
+#ifndef SSD1306_SPRITE_DAMAGE
+#define SSD1306_SPRITE_DAMAGE   (8)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Movable bitmap drawn over a background
+ */
+typedef struct
+{
+	const uint8_t* bitmap;      /*!< Page-major columns, w * ((h + 7) / 8) bytes as for @ref ssd1306_draw_columns */
+	const uint8_t* mask;        /*!< Set bits mark the pixels of the sprite, laid out like bitmap.
+	                                 NULL covers the whole box, the bitmap itself draws only its set pixels */
+	uint16_t w;                 /*!< Width in units of pixels */
+	uint16_t h;                 /*!< Height in units of pixels */
+	int16_t x;                  /*!< Screen X location, may be changed at any time */
+	int16_t y;                  /*!< Screen Y location, may be changed at any time */
+	uint8_t z;                  /*!< Sprites of higher z are drawn on top */
+	uint8_t visible;            /*!< Zero hides the sprite, may be changed at any time */
+	uint8_t changed;            /*!< Set when bitmap or mask changed */
+	ssd1306_rect_t drawn;       /*!< Area on screen after the last update, empty when not drawn */
+} ssd1306_sprite_t;
+
+/**
+ * @brief  Sprites sharing a background
+ */
+typedef struct
+{
+	const ssd1306_canvas_t* background;               /*!< Screen without sprites, NULL for black */
+	ssd1306_sprite_t* sprites[SSD1306_SPRITES];       /*!< Sorted by z */
+	uint8_t count;                                    /*!< Number of sprites */
+	ssd1306_rect_t damage[SSD1306_SPRITE_DAMAGE];     /*!< Background areas to redraw */
+	uint8_t damaged;                                  /*!< Number of damaged areas */
+} ssd1306_sprite_list_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes an empty sprite list
+ * @param  *list: Pointer to @ref ssd1306_sprite_list_t structure
+ * @param  *background: Pointer to @ref ssd1306_canvas_t structure with the screen without
+ *         sprites, at least SSD1306_WIDTH x SSD1306_HEIGHT. NULL for a black background
+ * @retval None
+ */
+void ssd1306_sprite_list_init(ssd1306_sprite_list_t* list, const ssd1306_canvas_t* background);
+
+/**
+ * @brief  Initializes a visible sprite, it is drawn by the next @ref ssd1306_sprite_update
+ * @param  *sprite: Pointer to @ref ssd1306_sprite_t structure
+ * @param  *bitmap: Pointer to page-major bitmap
+ * @param  *mask: Pointer to page-major mask, NULL for an opaque box. Pass bitmap to draw its set pixels only
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @param  z: Drawing order, higher on top
+ * @retval None
+ */
+void ssd1306_sprite_init(ssd1306_sprite_t* sprite, const uint8_t* bitmap, const uint8_t* mask, uint16_t w, uint16_t h, uint8_t z);
+
+/**
+ * @brief  Adds a sprite to a list, after the sprites of the same z
+ * @param  *list: Pointer to @ref ssd1306_sprite_list_t structure
+ * @param  *sprite: Pointer to @ref ssd1306_sprite_t structure, it must stay valid while used
+ * @retval 1 when added, 0 when the list is full
+ */
+uint8_t ssd1306_sprite_add(ssd1306_sprite_list_t* list, ssd1306_sprite_t* sprite);
+
+/**
+ * @brief  Changes bitmap and mask of a sprite, for animation frames of the same size
+ * @param  *sprite: Pointer to @ref ssd1306_sprite_t structure
+ * @param  *bitmap: Pointer to page-major bitmap
+ * @param  *mask: Pointer to page-major mask, NULL for an opaque box. Pass bitmap to draw its set pixels only
+ * @retval None
+ */
+void ssd1306_sprite_set_bitmap(ssd1306_sprite_t* sprite, const uint8_t* bitmap, const uint8_t* mask);
+
+/**
+ * @brief  Marks an area of the background that changed
+ * @param  *list: Pointer to @ref ssd1306_sprite_list_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval None
+ */
+void ssd1306_sprite_damage(ssd1306_sprite_list_t* list, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Redraws moved, changed, shown and hidden sprites and sends them to the LCD
+ * @note   For every such sprite the union of its old and new area gets the background back
+ *         and the sprites over it, column by column as 64-bit words. Only these areas are
+ *         written and sent, the screen is never cleared. Nothing is done while the screen is
+ *         rotated to portrait
+ * @param  *list: Pointer to @ref ssd1306_sprite_list_t structure
+ * @retval Number of areas sent
+ */
+uint8_t ssd1306_sprite_update(ssd1306_sprite_list_t* list);
+
+/**
+ * @brief  Checks two sprites for overlapping pixels
+ * @note   Masks of the common columns are ANDed, so touching boxes with no common set pixel do not collide.
+ *         Positions x and y are used, hidden sprites are checked too
+ * @param  *a: Pointer to first @ref ssd1306_sprite_t structure
+ * @param  *b: Pointer to second @ref ssd1306_sprite_t structure
+ * @retval 1 when at least one pixel overlaps, 0 otherwise
+ */
+uint8_t ssd1306_sprite_collide(const ssd1306_sprite_t* a, const ssd1306_sprite_t* b);
+
+#endif /* _SSD1306_SPRITE_H */
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_textfield.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_TEXTFIELD_H
+#define _SSD1306_TEXTFIELD_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Maximum number of characters of a text field
+ */
+#ifndef SSD1306_TEXTFIELD_LENGTH
+#define SSD1306_TEXTFIELD_LENGTH    (16)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Fixed-position text that only redraws and sends the glyphs that changed
+ */
+typedef struct
+{
+	const FontPageDef_t *Font;      /*!< Font used by the field */
+	uint16_t x;                     /*!< Top left X location */
+	uint16_t y;                     /*!< Top left Y location */
+	ssd1306_color_t color;          /*!< Text color, the background uses the opposite color */
+	uint16_t width;                 /*!< Width of the text on screen in units of pixels */
+	uint8_t length;                 /*!< Number of characters on screen */
+	uint8_t valid;                  /*!< Zero when the screen does not hold the field anymore */
+	uint16_t text[SSD1306_TEXTFIELD_LENGTH]; /*!< Characters on screen */
+} ssd1306_textfield_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a text field, nothing is drawn until @ref ssd1306_textfield_set
+ * @param  *field: Pointer to @ref ssd1306_textfield_t structure
+ * @param  x: Top left X location
+ * @param  y: Top left Y location
+ * @param  *Font: Pointer to @ref FontPageDef_t font used by the field
+ * @param  color: Text color. This parameter can be a value of @ref ssd1306_COLOR_t enumeration
+ * @retval None
+ */
+void ssd1306_textfield_init(ssd1306_textfield_t* field, uint16_t x, uint16_t y, const FontPageDef_t* Font, ssd1306_color_t color);
+
+/**
+ * @brief  Sets text of a field, redrawing only the glyphs that changed
+ * @note   Changed columns are sent to the LCD right away, @ref ssd1306_update_screen() is not needed.
+ *         Glyphs are always drawn opaque and the cursor of the putc functions is moved
+ * @note   With proportional fonts, a glyph of different width moves all glyphs after it, which are redrawn too.
+ *         Space left by a shorter text is cleared
+ * @param  *field: Pointer to @ref ssd1306_textfield_t structure
+ * @param  *str: UTF-8 string, characters that do not fit or are not part of the font are dropped
+ * @retval Number of glyphs redrawn
+ */
+uint8_t ssd1306_textfield_set(ssd1306_textfield_t* field, const char* str);
+
+/**
+ * @brief  Forces the next @ref ssd1306_textfield_set to redraw the whole field
+ * @note   Call it after the screen under the field was cleared or drawn over
+ * @param  *field: Pointer to @ref ssd1306_textfield_t structure
+ * @retval None
+ */
+void ssd1306_textfield_invalidate(ssd1306_textfield_t* field);
+
+#endif /* _SSD1306_TEXTFIELD_H */
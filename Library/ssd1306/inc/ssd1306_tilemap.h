@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_tilemap.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_TILEMAP_H
+#define _SSD1306_TILEMAP_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#define SSD1306_TILEMAP_COLUMNS     (SSD1306_WIDTH / 8)
+#define SSD1306_TILEMAP_ROWS        (SSD1306_HEIGHT / 8)
+
+/**
+ * @brief  Tiles sent per bus transfer, each one takes 8 bytes of stack
+ */
+#ifndef SSD1306_TILEMAP_CHUNK
+#define SSD1306_TILEMAP_CHUNK       (4)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Screen made of 8x8 tiles, one byte per tile instead of a frame buffer
+ */
+typedef struct
+{
+	const uint8_t* tiles;                                       /*!< Tile set, 8 column bytes per tile, LSB on top */
+	uint8_t map[SSD1306_TILEMAP_ROWS][SSD1306_TILEMAP_COLUMNS]; /*!< Tile index of every cell, row 0 is page 0 */
+	uint16_t dirty[SSD1306_TILEMAP_ROWS];                       /*!< One bit per cell to be sent, bit 0 is column 0 */
+} ssd1306_tilemap_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a tilemap with every cell set to one tile
+ * @note   Every cell is dirty, so the next @ref ssd1306_tilemap_flush sends the whole screen
+ * @param  *map: Pointer to @ref ssd1306_tilemap_t structure
+ * @param  *tiles: Pointer to tile set, 8 bytes per tile, usually in flash
+ * @param  tile: Tile index of every cell
+ * @retval None
+ */
+void ssd1306_tilemap_init(ssd1306_tilemap_t* map, const uint8_t* tiles, uint8_t tile);
+
+/**
+ * @brief  Sets the tile of a cell, marking it dirty only when it changes
+ * @param  *map: Pointer to @ref ssd1306_tilemap_t structure
+ * @param  column: Cell column. Valid input is 0 to SSD1306_TILEMAP_COLUMNS - 1
+ * @param  row: Cell row, the LCD page. Valid input is 0 to SSD1306_TILEMAP_ROWS - 1
+ * @param  tile: Tile index
+ * @retval None
+ */
+void ssd1306_tilemap_set(ssd1306_tilemap_t* map, uint8_t column, uint8_t row, uint8_t tile);
+
+/**
+ * @brief  Sets the tiles of consecutive cells from a string, one tile per character
+ * @note   The tile of a character is its code minus first, so a tile set of a font
+ *         starting at ' ' uses first = ' '. Characters past the last column are dropped
+ * @param  *map: Pointer to @ref ssd1306_tilemap_t structure
+ * @param  column: First cell column
+ * @param  row: Cell row
+ * @param  *str: String to be written
+ * @param  first: Character drawn by tile 0
+ * @retval Number of cells written
+ */
+uint8_t ssd1306_tilemap_puts(ssd1306_tilemap_t* map, uint8_t column, uint8_t row, const char* str, uint8_t first);
+
+/**
+ * @brief  Marks every cell dirty, after the LCD was changed by other means
+ * @param  *map: Pointer to @ref ssd1306_tilemap_t structure
+ * @retval None
+ */
+void ssd1306_tilemap_invalidate(ssd1306_tilemap_t* map);
+
+/**
+ * @brief  Sends the dirty cells to the LCD
+ * @note   Tile bytes are streamed from the tile set straight to GDDRAM, runs of dirty cells
+ *         of a row share one address setup. Internal RAM is not used. While the screen is
+ *         rotated to portrait nothing is sent and the cells stay dirty
+ * @param  *map: Pointer to @ref ssd1306_tilemap_t structure
+ * @retval Number of cells sent
+ */
+uint16_t ssd1306_tilemap_flush(ssd1306_tilemap_t* map);
+
+#endif /* _SSD1306_TILEMAP_H */
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_viewport.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SSD1306_VIEWPORT_H
+#define _SSD1306_VIEWPORT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/**
+ * @brief  Bytes of a shifted page composed per bus transfer, taken from the stack
+ */
+#ifndef SSD1306_VIEWPORT_CHUNK
+#define SSD1306_VIEWPORT_CHUNK      (32)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * @brief  Window of the LCD size over a larger canvas
+ */
+typedef struct
+{
+	const ssd1306_canvas_t* canvas;  /*!< Virtual canvas shown, usually larger than the LCD */
+	int16_t x;                       /*!< Left column of the window in the canvas */
+	int16_t y;                       /*!< Top row of the window in the canvas */
+	uint8_t start_line;              /*!< GDDRAM row shown on top of the LCD */
+	uint8_t shown;                   /*!< The window was sent by @ref ssd1306_viewport_flush */
+} ssd1306_viewport_t;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+
+/**
+ * @brief  Initializes a viewport on the top left corner of a canvas
+ * @note   Nothing is sent until @ref ssd1306_viewport_flush or the first move
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @param  *canvas: Pointer to @ref ssd1306_canvas_t structure, it must stay valid
+ * @retval None
+ */
+void ssd1306_viewport_init(ssd1306_viewport_t* vp, const ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Sends the whole window to the LCD, straight from the canvas
+ * @note   Internal RAM is not used. Areas outside the canvas are black. Viewport functions
+ *         send nothing while the screen is rotated to portrait
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @retval Number of pages sent
+ */
+uint8_t ssd1306_viewport_flush(ssd1306_viewport_t* vp);
+
+/**
+ * @brief  Moves the window and sends what changed on the LCD
+ * @note   Vertical moves turn GDDRAM into a ring with the display start line, so only
+ *         the pages holding the rows scrolled into view are sent. Moves by multiples
+ *         of 8 rows send whole canvas pages without copying them. Horizontal moves
+ *         send the whole window, the LCD has no column offset
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @param  x: New left column of the window, clamped to the canvas
+ * @param  y: New top row of the window, clamped to the canvas
+ * @retval Number of pages sent
+ */
+uint8_t ssd1306_viewport_move(ssd1306_viewport_t* vp, int16_t x, int16_t y);
+
+/**
+ * @brief  Moves the window relative to its position, see @ref ssd1306_viewport_move
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @param  dx: Columns to move, positive to the right
+ * @param  dy: Rows to move, positive down
+ * @retval Number of pages sent
+ */
+uint8_t ssd1306_viewport_scroll(ssd1306_viewport_t* vp, int16_t dx, int16_t dy);
+
+/**
+ * @brief  Sends a rectangle of the canvas redrawn by the application, when it is visible
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @param  x: Top left X location in the canvas
+ * @param  y: Top left Y location in the canvas
+ * @param  w: Width in units of pixels
+ * @param  h: Height in units of pixels
+ * @retval Number of pages sent
+ */
+uint8_t ssd1306_viewport_update_area(ssd1306_viewport_t* vp, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Gives the LCD back to internal RAM, the display start line is reset
+ * @note   @ref ssd1306_update_screen() must be called after that in order to see internal RAM
+ * @param  *vp: Pointer to @ref ssd1306_viewport_t structure
+ * @retval None
+ */
+void ssd1306_viewport_close(ssd1306_viewport_t* vp);
+
+#endif /* _SSD1306_VIEWPORT_H */
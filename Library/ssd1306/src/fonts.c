@@ -119,6 +119,7 @@ const uint16_t Font7x10 [] = {
 0x0000, 0x0000, 0x0000, 0x7400, 0x4C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // ~
 };
 
+#if FONTS_USE_11X18
 const uint16_t Font11x18 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // sp
 0x0000, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000,   // !
@@ -216,7 +217,9 @@ const uint16_t Font11x18 [] = {
 0x3800, 0x3C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0E00, 0x0700, 0x0700, 0x0E00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x3C00, 0x3800,   // }
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3880, 0x7F80, 0x4700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // ~
 };
+#endif /* FONTS_USE_11X18 */
 
+#if FONTS_USE_16X26
 const uint16_t Font16x26 [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [ ]
 0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03C0,0x03C0,0x01C0,0x01C0,0x01C0,0x01C0,0x01C0,0x0000,0x0000,0x0000,0x03E0,0x03E0,0x03E0,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [!]
@@ -314,6 +317,7 @@ const uint16_t Font16x26 [] = {
 0x3FC0,0x03E0,0x01E0,0x01E0,0x01E0,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x00FE,0x00FE,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x01E0,0x01E0,0x01E0,0x03E0,0x3FC0,0x3F00,0x0000, // Ascii = [}]
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
+#endif /* FONTS_USE_16X26 */
 
 FontDef_t Font_7x10 = {
 	7,
@@ -321,17 +325,21 @@ FontDef_t Font_7x10 = {
 	Font7x10
 };
 
+#if FONTS_USE_11X18
 FontDef_t Font_11x18 = {
 	11,
 	18,
 	Font11x18
 };
+#endif /* FONTS_USE_11X18 */
 
+#if FONTS_USE_16X26
 FontDef_t Font_16x26 = {
 	16,
 	26,
 	Font16x26
 };
+#endif /* FONTS_USE_16X26 */
 
 /* Private function prototypes -----------------------------------------------*/
 /* Private user code ---------------------------------------------------------*/
@@ -345,3 +353,180 @@ char *FONTS_GetStringSize(char* str, FONTS_SIZE_t* SizeStruct, FontDef_t* Font)
 	/* Return pointer */
 	return str;
 }
+
+uint8_t FONTS_ConvertToPage(const FontDef_t* Font, uint8_t* data, uint32_t size, FontPageDef_t* PageFont)
+{
+	uint32_t glyph_size, c, i, j;
+	uint16_t b;
+	uint8_t* glyph;
+
+	/* Check available space */
+	if (size < (uint32_t)FONTS_PAGE_DATA_SIZE(Font->FontWidth, Font->FontHeight))
+	{
+		return 0;
+	}
+
+	glyph_size = Font->FontWidth * FONTS_PAGES(Font->FontHeight);
+	memset(data, 0, glyph_size * (FONTS_LAST_CHAR - FONTS_FIRST_CHAR + 1));
+
+	/* Transpose every glyph row into column bytes */
+	for (c = 0; c <= (FONTS_LAST_CHAR - FONTS_FIRST_CHAR); c++)
+	{
+		glyph = &data[c * glyph_size];
+		for (i = 0; i < Font->FontHeight; i++)
+		{
+			b = Font->data[c * Font->FontHeight + i];
+			for (j = 0; j < Font->FontWidth; j++)
+			{
+				if ((b << j) & 0x8000)
+				{
+					glyph[(i / 8) * Font->FontWidth + j] |= 1 << (i % 8);
+				}
+			}
+		}
+	}
+
+	/* Fill settings */
+	PageFont->FontWidth = Font->FontWidth;
+	PageFont->FontHeight = Font->FontHeight;
+	PageFont->FirstChar = FONTS_FIRST_CHAR;
+	PageFont->LastChar = FONTS_LAST_CHAR;
+	PageFont->data = data;
+	PageFont->Format = FONTS_FORMAT_PAGE;
+	PageFont->Index = NULL;
+	PageFont->CharMap = NULL;
+	PageFont->GlyphCount = FONTS_LAST_CHAR - FONTS_FIRST_CHAR + 1;
+	PageFont->Glyphs = NULL;
+	PageFont->Baseline = 0;
+
+	return 1;
+}
+
+int32_t FONTS_GetGlyphIndex(const FontPageDef_t* Font, uint16_t ch)
+{
+	int32_t low, high, mid;
+
+	/* Check character range */
+	if ((ch < Font->FirstChar) || (ch > Font->LastChar))
+	{
+		return -1;
+	}
+
+	/* Contiguous fonts are indexed directly */
+	if (Font->CharMap == NULL)
+	{
+		return ch - Font->FirstChar;
+	}
+
+	/* Binary search in sorted subset */
+	low = 0;
+	high = Font->GlyphCount - 1;
+	while (low <= high)
+	{
+		mid = (low + high) / 2;
+		if (Font->CharMap[mid] == ch)
+		{
+			return mid;
+		}
+		if (Font->CharMap[mid] < ch)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	return -1;
+}
+
+uint8_t FONTS_GetGlyphAdvance(const FontPageDef_t* Font, int32_t glyph)
+{
+	/* Monospace fonts advance a whole cell */
+	if (Font->Glyphs == NULL)
+	{
+		return Font->FontWidth;
+	}
+
+	return Font->Glyphs[glyph].Advance;
+}
+
+uint16_t FONTS_GetStringWidth(const char* str, const FontPageDef_t* Font)
+{
+	uint16_t width = 0;
+	int32_t glyph;
+	uint16_t ch;
+
+	while ((ch = FONTS_DecodeUTF8(&str)) != 0)
+	{
+		glyph = FONTS_GetGlyphIndex(Font, ch);
+		if (glyph < 0)
+		{
+			break;
+		}
+		width += FONTS_GetGlyphAdvance(Font, glyph);
+	}
+
+	return width;
+}
+
+uint16_t FONTS_DecodeUTF8(const char** str)
+{
+	const uint8_t* s = (const uint8_t*)*str;
+	uint32_t ch;
+	uint8_t count, i;
+
+	/* Single byte */
+	if (s[0] < 0x80)
+	{
+		if (s[0] != 0)
+		{
+			(*str)++;
+		}
+		return s[0];
+	}
+
+	/* Sequence length from lead byte */
+	if ((s[0] & 0xE0) == 0xC0)
+	{
+		ch = s[0] & 0x1F;
+		count = 1;
+	}
+	else if ((s[0] & 0xF0) == 0xE0)
+	{
+		ch = s[0] & 0x0F;
+		count = 2;
+	}
+	else if ((s[0] & 0xF8) == 0xF0)
+	{
+		ch = s[0] & 0x07;
+		count = 3;
+	}
+	else
+	{
+		(*str)++;
+		return s[0];
+	}
+
+	/* Continuation bytes */
+	for (i = 1; i <= count; i++)
+	{
+		if ((s[i] & 0xC0) != 0x80)
+		{
+			(*str)++;
+			return s[0];
+		}
+		ch = (ch << 6) | (s[i] & 0x3F);
+	}
+
+	/* Reject overlong forms */
+	if (ch < ((count == 1) ? 0x80 : ((count == 2) ? 0x800 : 0x10000)))
+	{
+		(*str)++;
+		return s[0];
+	}
+
+	*str += count + 1;
+	return (ch > 0xFFFF) ? 0xFFFD : (uint16_t)ch;
+}
@@ -0,0 +1,439 @@
+/**
+ ******************************************************************************
+ * @file    fonts_packed.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Generated by Tools/fonttool.py, do not edit.
+ *
+ * Flash usage in bytes:
+ * font           uint16     page   packed      rle     prop
+ * Font_7x10        1900     1330      857     1075     1198
+ * Font_11x18       3420     3135     1580     2084     2122
+ * Font_16x26       4940     6080     3386     3436     4280
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t Font_7x10_Packed_Index[] = {
+	0x0000, 0x0003, 0x0007, 0x000C, 0x0014, 0x001D, 0x0025, 0x002D, 0x0031, 0x0038, 0x003F, 0x0044,
+	0x004B, 0x004F, 0x0053, 0x0057, 0x005D, 0x0065, 0x006B, 0x0073, 0x007B, 0x0083, 0x008B, 0x0093,
+	0x009B, 0x00A3, 0x00AB, 0x00AF, 0x00B3, 0x00BA, 0x00BF, 0x00C6, 0x00CE, 0x00D6, 0x00DE, 0x00E6,
+	0x00EE, 0x00F6, 0x00FE, 0x0106, 0x010E, 0x0116, 0x011C, 0x0124, 0x012C, 0x0134, 0x013C, 0x0144,
+	0x014C, 0x0154, 0x015D, 0x0165, 0x016D, 0x0175, 0x017D, 0x0185, 0x018D, 0x0195, 0x019D, 0x01A5,
+	0x01AB, 0x01B1, 0x01B7, 0x01BD, 0x01C1, 0x01C5, 0x01CC, 0x01D4, 0x01DB, 0x01E3, 0x01EA, 0x01F2,
+	0x01FA, 0x0202, 0x0208, 0x0210, 0x0218, 0x021E, 0x0225, 0x022C, 0x0233, 0x023B, 0x0243, 0x024A,
+	0x0251, 0x0258, 0x025F, 0x0266, 0x026D, 0x0274, 0x027C, 0x0283, 0x028A, 0x028F, 0x0296,
+};
+
+static const uint8_t Font_7x10_Packed_Data[] = {
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x30, 0xBF, 0x00, 0x03, 0x22, 0xC7, 0x01, 0x00, 0x08, 0x14, 0xF4,
+	0x2F, 0x24, 0xF4, 0x2F, 0x00, 0x09, 0x14, 0x66, 0x12, 0xFD, 0x4F, 0x24, 0x07, 0x00, 0x08, 0x14,
+	0x26, 0x19, 0x6E, 0x94, 0x62, 0x00, 0x08, 0x14, 0x60, 0x96, 0x99, 0x66, 0x90, 0x00, 0x03, 0x30,
+	0x07, 0x00, 0x0A, 0x22, 0xFC, 0x08, 0x14, 0x20, 0x00, 0x0A, 0x22, 0x01, 0x0A, 0xC4, 0x0F, 0x00,
+	0x04, 0x22, 0x7A, 0x0A, 0x02, 0x05, 0x14, 0x84, 0x7C, 0x42, 0x00, 0x07, 0x03, 0x30, 0x07, 0x05,
+	0x01, 0x22, 0x07, 0x07, 0x01, 0x30, 0x01, 0x00, 0x08, 0x22, 0xC0, 0x3C, 0x03, 0x00, 0x08, 0x14,
+	0x7E, 0x81, 0x89, 0x81, 0x7E, 0x00, 0x08, 0x12, 0x04, 0x02, 0xFF, 0x00, 0x08, 0x14, 0x86, 0xC1,
+	0xA1, 0x91, 0x8E, 0x00, 0x08, 0x14, 0x42, 0x81, 0x89, 0x89, 0x76, 0x00, 0x08, 0x14, 0x30, 0x2C,
+	0x22, 0xFF, 0x20, 0x00, 0x08, 0x14, 0x4F, 0x89, 0x89, 0x89, 0x71, 0x00, 0x08, 0x14, 0x7E, 0x89,
+	0x89, 0x89, 0x72, 0x00, 0x08, 0x14, 0x01, 0xE1, 0x19, 0x05, 0x03, 0x00, 0x08, 0x14, 0x76, 0x89,
+	0x89, 0x89, 0x76, 0x00, 0x08, 0x14, 0x4E, 0x91, 0x91, 0x91, 0x7E, 0x02, 0x06, 0x30, 0x21, 0x03,
+	0x07, 0x30, 0x71, 0x02, 0x05, 0x14, 0x44, 0xA9, 0x18, 0x01, 0x03, 0x03, 0x14, 0x6D, 0x5B, 0x02,
+	0x05, 0x14, 0x31, 0x2A, 0x45, 0x00, 0x00, 0x08, 0x14, 0x02, 0x01, 0xB1, 0x09, 0x06, 0x00, 0x08,
+	0x14, 0x7E, 0x81, 0x99, 0x95, 0x1E, 0x00, 0x08, 0x14, 0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0x00, 0x08,
+	0x14, 0xFF, 0x89, 0x89, 0x89, 0x76, 0x00, 0x08, 0x14, 0x7E, 0x81, 0x81, 0x81, 0x42, 0x00, 0x08,
+	0x14, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0x08, 0x14, 0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x08,
+	0x14, 0xFF, 0x09, 0x09, 0x09, 0x01, 0x00, 0x08, 0x14, 0x7E, 0x81, 0x91, 0x91, 0x72, 0x00, 0x08,
+	0x14, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00, 0x08, 0x22, 0x81, 0xFF, 0x81, 0x00, 0x08, 0x14, 0x40,
+	0x80, 0x80, 0x80, 0x7F, 0x00, 0x08, 0x14, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0x08, 0x14, 0xFF,
+	0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x00, 0x08, 0x14, 0xFF,
+	0x06, 0x18, 0x60, 0xFF, 0x00, 0x08, 0x14, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x08, 0x14, 0xFF,
+	0x11, 0x11, 0x11, 0x0E, 0x00, 0x09, 0x14, 0x7E, 0x02, 0x05, 0x0B, 0xE4, 0x17, 0x00, 0x08, 0x14,
+	0xFF, 0x11, 0x11, 0x71, 0x8E, 0x00, 0x08, 0x14, 0x46, 0x89, 0x89, 0x91, 0x62, 0x00, 0x08, 0x14,
+	0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x08, 0x14, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x08, 0x14,
+	0x07, 0x38, 0xC0, 0x38, 0x07, 0x00, 0x08, 0x14, 0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x00, 0x08, 0x14,
+	0x81, 0x66, 0x18, 0x66, 0x81, 0x00, 0x08, 0x14, 0x03, 0x0C, 0xF0, 0x0C, 0x03, 0x00, 0x08, 0x14,
+	0xC1, 0xA1, 0x99, 0x85, 0x83, 0x00, 0x0A, 0x31, 0xFF, 0x07, 0x08, 0x00, 0x08, 0x22, 0x03, 0x3C,
+	0xC0, 0x00, 0x0A, 0x21, 0x01, 0xFE, 0x0F, 0x00, 0x04, 0x14, 0x68, 0x61, 0x08, 0x09, 0x01, 0x06,
+	0x7F, 0x00, 0x02, 0x21, 0x09, 0x02, 0x06, 0x14, 0x5A, 0x59, 0x56, 0x3E, 0x00, 0x08, 0x14, 0xFF,
+	0x48, 0x84, 0x84, 0x78, 0x02, 0x06, 0x14, 0x5E, 0x18, 0x86, 0x12, 0x00, 0x08, 0x14, 0x78, 0x84,
+	0x84, 0x48, 0xFF, 0x02, 0x06, 0x14, 0x5E, 0x59, 0x96, 0x16, 0x00, 0x08, 0x14, 0x04, 0x04, 0xFE,
+	0x05, 0x05, 0x02, 0x08, 0x14, 0x9E, 0xA1, 0xA1, 0x92, 0x7F, 0x00, 0x08, 0x14, 0xFF, 0x08, 0x04,
+	0x04, 0xF8, 0x00, 0x08, 0x12, 0x04, 0x04, 0xFD, 0x00, 0x0A, 0x03, 0x00, 0x12, 0x48, 0x60, 0x7F,
+	0x00, 0x08, 0x14, 0xFF, 0x10, 0x28, 0x44, 0x80, 0x00, 0x08, 0x12, 0x01, 0x01, 0xFF, 0x02, 0x06,
+	0x14, 0x7F, 0xF0, 0x07, 0x3E, 0x02, 0x06, 0x14, 0xBF, 0x10, 0x04, 0x3E, 0x02, 0x06, 0x14, 0x5E,
+	0x18, 0x86, 0x1E, 0x02, 0x08, 0x14, 0xFF, 0x12, 0x21, 0x21, 0x1E, 0x02, 0x08, 0x14, 0x1E, 0x21,
+	0x21, 0x12, 0xFF, 0x02, 0x06, 0x14, 0xBF, 0x10, 0x04, 0x02, 0x02, 0x06, 0x14, 0x52, 0x59, 0xA6,
+	0x12, 0x00, 0x08, 0x13, 0x04, 0x7F, 0x84, 0x84, 0x02, 0x06, 0x14, 0x1F, 0x08, 0x42, 0x3F, 0x02,
+	0x06, 0x14, 0x03, 0x07, 0x72, 0x03, 0x02, 0x06, 0x14, 0x0F, 0x7E, 0xE0, 0x0F, 0x02, 0x06, 0x14,
+	0xA1, 0xC4, 0x48, 0x21, 0x02, 0x08, 0x14, 0x83, 0x8C, 0x70, 0x0C, 0x03, 0x02, 0x06, 0x14, 0x71,
+	0x5A, 0x8E, 0x21, 0x00, 0x0A, 0x22, 0x30, 0x3C, 0x1F, 0x20, 0x00, 0x0A, 0x30, 0xFF, 0x03, 0x00,
+	0x0A, 0x22, 0x01, 0x3E, 0x0F, 0x03, 0x03, 0x02, 0x14, 0x97, 0x03,
+};
+
+FontPageDef_t Font_7x10_Packed = {
+	7,
+	10,
+	32,
+	126,
+	Font_7x10_Packed_Data,
+	FONTS_FORMAT_PACKED,
+	Font_7x10_Packed_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
+
+static const uint16_t Font_11x18_Packed_Index[] = {
+	0x0000, 0x0003, 0x000A, 0x0011, 0x0024, 0x0037, 0x004C, 0x005F, 0x0064, 0x0073, 0x0082, 0x0089,
+	0x0099, 0x009E, 0x00A2, 0x00A6, 0x00B2, 0x00C3, 0x00CF, 0x00E0, 0x00F1, 0x0102, 0x0113, 0x0124,
+	0x0135, 0x0146, 0x0157, 0x015D, 0x0163, 0x016F, 0x0178, 0x0184, 0x0197, 0x01A8, 0x01BB, 0x01CC,
+	0x01DD, 0x01EE, 0x01FF, 0x0210, 0x0221, 0x0232, 0x0240, 0x0251, 0x0264, 0x0275, 0x0288, 0x0299,
+	0x02AA, 0x02BB, 0x02CE, 0x02E1, 0x02F2, 0x0307, 0x0318, 0x032B, 0x0340, 0x0355, 0x036A, 0x037B,
+	0x0387, 0x0393, 0x039F, 0x03AA, 0x03AF, 0x03B4, 0x03C3, 0x03D4, 0x03E1, 0x03F2, 0x03FF, 0x0412,
+	0x0423, 0x0434, 0x0440, 0x0451, 0x0464, 0x0470, 0x0480, 0x048D, 0x049A, 0x04AB, 0x04BC, 0x04C9,
+	0x04D6, 0x04E6, 0x04F3, 0x0502, 0x0511, 0x051E, 0x052F, 0x053E, 0x054F, 0x0557, 0x0568,
+};
+
+static const uint8_t Font_11x18_Packed_Data[] = {
+	0x00, 0x00, 0x00, 0x01, 0x0E, 0x41, 0xFF, 0xF7, 0xFF, 0x0D, 0x01, 0x05, 0x34, 0xFF, 0x83, 0xFF,
+	0x01, 0x01, 0x0E, 0x18, 0x30, 0x03, 0xEC, 0xFF, 0xFF, 0xFF, 0x0D, 0x30, 0x03, 0xEC, 0xFF, 0xFF,
+	0xFF, 0x0D, 0x30, 0x03, 0x01, 0x10, 0x17, 0x1C, 0x0E, 0x3E, 0x1E, 0x77, 0x38, 0x63, 0x30, 0xFF,
+	0xFF, 0xC3, 0x30, 0x8E, 0x1F, 0x0C, 0x0F, 0x01, 0x0E, 0x09, 0x1E, 0xC0, 0x0F, 0x13, 0x62, 0xFC,
+	0x0C, 0x9E, 0x01, 0xB0, 0x07, 0xF6, 0xC3, 0x84, 0x18, 0x3F, 0x83, 0x07, 0x01, 0x0E, 0x18, 0x00,
+	0x8F, 0xE7, 0xF7, 0x0B, 0x8F, 0xC3, 0xE3, 0xF1, 0xCF, 0xE6, 0xE1, 0x00, 0xFE, 0x80, 0x11, 0x01,
+	0x05, 0x41, 0xFF, 0x03, 0x00, 0x12, 0x44, 0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0x01, 0x8E, 0x01, 0x60,
+	0x01, 0x00, 0x02, 0x00, 0x12, 0x24, 0x01, 0x00, 0x1A, 0x00, 0xC6, 0x01, 0x0E, 0xFE, 0x1F, 0xC0,
+	0x0F, 0x00, 0x01, 0x05, 0x25, 0x96, 0xBF, 0xC7, 0x2D, 0x03, 0x0A, 0x09, 0x30, 0xC0, 0x00, 0x03,
+	0x0C, 0xFF, 0xFF, 0x0F, 0x03, 0x0C, 0x30, 0xC0, 0x00, 0x0D, 0x05, 0x41, 0xF3, 0x01, 0x09, 0x02,
+	0x33, 0xFF, 0x0D, 0x02, 0x41, 0x0F, 0x01, 0x0E, 0x34, 0x00, 0x38, 0xE0, 0x8F, 0x7F, 0xFC, 0x01,
+	0x07, 0x00, 0x01, 0x0E, 0x17, 0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC3, 0xC3, 0xF0, 0x01, 0xEE,
+	0xFF, 0xE1, 0x1F, 0x01, 0x0E, 0x24, 0x18, 0x00, 0x03, 0x60, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x01,
+	0x0E, 0x17, 0x1C, 0xB8, 0x07, 0x7F, 0x60, 0x0F, 0xCC, 0x83, 0xF1, 0x31, 0xEC, 0x07, 0xF3, 0xC0,
+	0x01, 0x0E, 0x17, 0x0C, 0x8C, 0x03, 0x37, 0x80, 0x8F, 0xC1, 0x63, 0xB0, 0x3F, 0xCE, 0xF9, 0x01,
+	0x3C, 0x01, 0x0E, 0x17, 0x00, 0x07, 0xF0, 0x81, 0x6F, 0x78, 0x18, 0xFF, 0xFF, 0xFF, 0x0F, 0x60,
+	0x00, 0x18, 0x01, 0x0E, 0x17, 0xFF, 0xCC, 0x3F, 0x37, 0x84, 0x8F, 0xC1, 0x63, 0xF0, 0x38, 0x3E,
+	0xFC, 0x01, 0x3E, 0x01, 0x0E, 0x17, 0xF8, 0x87, 0xFF, 0x77, 0x8C, 0x8F, 0xC1, 0x63, 0xF0, 0x39,
+	0xEE, 0xFC, 0x31, 0x3E, 0x01, 0x0E, 0x17, 0x03, 0xC0, 0x00, 0x30, 0x80, 0x0F, 0xFE, 0xE3, 0xC3,
+	0x1E, 0xF0, 0x01, 0x1C, 0x00, 0x01, 0x0E, 0x17, 0x1C, 0x8F, 0xEF, 0x37, 0x0C, 0x0F, 0xC3, 0xC3,
+	0xF0, 0x31, 0xEC, 0xFB, 0x71, 0x3C, 0x01, 0x0E, 0x17, 0x7C, 0x8C, 0x3F, 0x77, 0x9C, 0x0F, 0xC6,
+	0x83, 0xF1, 0x31, 0xEE, 0xFF, 0xE1, 0x1F, 0x05, 0x0A, 0x41, 0x03, 0x0F, 0x0C, 0x06, 0x0C, 0x41,
+	0x83, 0x39, 0x78, 0x04, 0x09, 0x17, 0x10, 0x70, 0xA0, 0x60, 0x43, 0xC4, 0x98, 0xA0, 0xC1, 0x05,
+	0x06, 0x17, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0x04, 0x09, 0x17, 0x83, 0x05, 0x19, 0x23, 0xC2,
+	0x06, 0x05, 0x0E, 0x08, 0x01, 0x0E, 0x18, 0x0C, 0x80, 0x03, 0x70, 0x00, 0x0C, 0xDC, 0x83, 0xF7,
+	0x70, 0x70, 0x0E, 0xF8, 0x01, 0x3C, 0x00, 0x01, 0x0E, 0x17, 0xF8, 0x87, 0xFF, 0xF7, 0x80, 0x8F,
+	0xC7, 0xE3, 0xF3, 0xCC, 0xE6, 0x3F, 0xF0, 0x0F, 0x01, 0x0E, 0x18, 0x00, 0x38, 0xF0, 0xCF, 0x7F,
+	0xFC, 0x0C, 0x03, 0xC3, 0xCF, 0xC0, 0x7F, 0x00, 0xFF, 0x00, 0x38, 0x01, 0x0E, 0x17, 0xFF, 0xFF,
+	0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xB0, 0x7F, 0xCE, 0xF3, 0x01, 0x38, 0x01, 0x0E, 0x17, 0xF8,
+	0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xEC, 0xC0, 0x31, 0x30, 0x01, 0x0E, 0x17,
+	0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xB0, 0x03, 0xE7, 0xFF, 0xE0, 0x0F, 0x01, 0x0E,
+	0x17, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC0, 0x01,
+	0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00,
+	0x01, 0x0E, 0x17, 0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x60, 0xEC, 0xF8, 0x31,
+	0x7E, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0xF0, 0xFF,
+	0xFF, 0xFF, 0x01, 0x0E, 0x25, 0x03, 0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0C,
+	0x01, 0x0E, 0x17, 0x00, 0x0E, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD,
+	0x3F, 0x01, 0x0E, 0x18, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x80, 0x03, 0xB8, 0x03, 0xC7, 0x61, 0xC0,
+	0x0D, 0xE0, 0x01, 0x20, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x30,
+	0x00, 0x0C, 0x00, 0x03, 0xC0, 0x01, 0x0E, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x01, 0xC0,
+	0x00, 0x1F, 0x70, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+	0xF0, 0x03, 0xE0, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x0E, 0x17, 0xF8, 0x87, 0xFF, 0x77,
+	0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xEE, 0xFF, 0xE1, 0x1F, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF,
+	0x3F, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0x71, 0xE0, 0x0F, 0xF0, 0x01, 0x01, 0x0E, 0x18, 0xF8, 0x87,
+	0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF6, 0x01, 0xEF, 0xFF, 0xE1, 0x5F, 0x00, 0x20, 0x01, 0x0E,
+	0x18, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC1, 0xF9, 0xE1, 0xE7, 0xF1, 0xE0, 0x00,
+	0x20, 0x01, 0x0E, 0x17, 0x00, 0x06, 0x8F, 0xE7, 0x87, 0x8F, 0xC1, 0xC3, 0xF0, 0x70, 0xEC, 0xF8,
+	0x31, 0x3C, 0x01, 0x0E, 0x09, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x0E, 0x17, 0xFF, 0xCF, 0xFF, 0x07, 0x80, 0x03,
+	0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD, 0x3F, 0x01, 0x0E, 0x18, 0x07, 0xC0, 0x0F, 0x80, 0x3F,
+	0x00, 0x7F, 0x00, 0x3C, 0xF0, 0x87, 0x3F, 0xFC, 0x00, 0x07, 0x00, 0x01, 0x0E, 0x09, 0x3F, 0xC0,
+	0xFF, 0x0F, 0x80, 0x03, 0x3C, 0xE0, 0x01, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00,
+	0x01, 0x0E, 0x09, 0x01, 0xE0, 0x01, 0xEE, 0xC1, 0xE1, 0x3C, 0xF0, 0x07, 0xF8, 0x80, 0x73, 0x70,
+	0x78, 0x07, 0x78, 0x00, 0x08, 0x01, 0x0E, 0x09, 0x01, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
+	0x3F, 0xF8, 0x8F, 0x07, 0x78, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0x0E, 0x17, 0x00, 0xF8, 0x00,
+	0x3F, 0x70, 0x0F, 0xCF, 0xE3, 0xF0, 0x0E, 0xFC, 0x01, 0x1F, 0xC0, 0x00, 0x12, 0x43, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0x00, 0xC0, 0x01, 0x0E, 0x34, 0x07, 0xC0, 0x1F, 0x80, 0x7F, 0x00,
+	0xFE, 0x00, 0x38, 0x00, 0x12, 0x33, 0x03, 0x00, 0x0F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+	0x08, 0x17, 0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0, 0x10, 0x01, 0x0A, 0xFF, 0x07, 0x01,
+	0x03, 0x23, 0xD9, 0x09, 0x05, 0x0A, 0x18, 0xC4, 0x99, 0x3F, 0xF3, 0xCC, 0x33, 0xCD, 0xF6, 0x9F,
+	0xFF, 0x00, 0x02, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0x0F, 0x86, 0xC1, 0xC0, 0x30, 0x30, 0x1C,
+	0x0E, 0xFE, 0x01, 0x3F, 0x05, 0x0A, 0x17, 0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1C,
+	0x33, 0x01, 0x0E, 0x17, 0xC0, 0x0F, 0xF8, 0x07, 0x87, 0xC3, 0xC0, 0x30, 0x30, 0x18, 0xF6, 0xFF,
+	0xFF, 0xFF, 0x05, 0x0A, 0x17, 0xFC, 0xF8, 0x77, 0xFB, 0xCC, 0x33, 0xDF, 0xEC, 0x1B, 0x2E, 0x01,
+	0x0E, 0x18, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x0C, 0x30, 0x03, 0xCC, 0x00,
+	0x03, 0x00, 0x04, 0x0E, 0x17, 0xFC, 0x98, 0x7F, 0x7E, 0x38, 0x0F, 0xCC, 0x03, 0xB3, 0x61, 0xFE,
+	0xFF, 0xFD, 0x3F, 0x01, 0x0E, 0x17, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0xC0, 0x00, 0x30, 0x00, 0x0C,
+	0x00, 0xFF, 0x83, 0xFF, 0x01, 0x0E, 0x24, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xCC, 0xFF, 0xF3, 0x3F,
+	0x00, 0x12, 0x15, 0x00, 0x80, 0xC1, 0x00, 0x0C, 0x03, 0x30, 0x0C, 0xC0, 0xF3, 0xFF, 0xCF, 0xFF,
+	0x07, 0x01, 0x0E, 0x18, 0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0x00, 0x06, 0xC0, 0x03, 0x98, 0x03, 0xC3,
+	0x41, 0xC0, 0x00, 0x20, 0x01, 0x0E, 0x24, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+	0x05, 0x0A, 0x09, 0xFF, 0xFF, 0x2F, 0xC0, 0x00, 0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0xFF, 0xFB, 0x0F,
+	0x05, 0x0A, 0x17, 0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xBF, 0xFF, 0x05, 0x0A, 0x17,
+	0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F, 0x04, 0x0E, 0x17, 0xFF, 0xFF, 0xFF,
+	0x6F, 0x18, 0x0C, 0x0C, 0x03, 0xC3, 0xE1, 0xE0, 0x1F, 0xF0, 0x03, 0x04, 0x0E, 0x17, 0xFC, 0x80,
+	0x7F, 0x70, 0x38, 0x0C, 0x0C, 0x03, 0x83, 0x61, 0xF0, 0xFF, 0xFF, 0xFF, 0x05, 0x0A, 0x17, 0x01,
+	0xFC, 0xEF, 0xBF, 0x01, 0x03, 0x0C, 0x70, 0x80, 0x00, 0x05, 0x0A, 0x17, 0x9C, 0xF9, 0x36, 0xF3,
+	0xCC, 0x33, 0xCF, 0x6C, 0x9F, 0x39, 0x02, 0x0D, 0x17, 0x18, 0x00, 0x03, 0xF8, 0xBF, 0xFF, 0x8F,
+	0x81, 0x31, 0x30, 0x06, 0x06, 0xC0, 0x05, 0x0A, 0x17, 0xFF, 0xFD, 0x0F, 0x30, 0xC0, 0x00, 0x03,
+	0xF6, 0xFF, 0xFF, 0x05, 0x0A, 0x18, 0x01, 0x3C, 0xE0, 0x07, 0x7C, 0x80, 0xC3, 0xEF, 0xC7, 0x03,
+	0x01, 0x00, 0x05, 0x0A, 0x08, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07,
+	0x00, 0x05, 0x0A, 0x17, 0x01, 0x1E, 0xEE, 0x1C, 0x1E, 0x78, 0x38, 0x77, 0x78, 0x80, 0x04, 0x0E,
+	0x17, 0x03, 0xF0, 0x07, 0xCC, 0x8F, 0x83, 0x7F, 0x00, 0x1F, 0xFE, 0xF1, 0x0F, 0x1C, 0x00, 0x05,
+	0x0A, 0x18, 0x03, 0x0F, 0x3E, 0xFC, 0xD8, 0x33, 0x6F, 0xFC, 0xF0, 0xC1, 0x03, 0x03, 0x00, 0x12,
+	0x35, 0x00, 0x03, 0x00, 0x1E, 0xE0, 0xFF, 0xDF, 0x3F, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x0C, 0x00,
+	0x12, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x12, 0x25, 0x03, 0x00, 0x0F, 0x00, 0xFC, 0xCF,
+	0xBF, 0xFF, 0x7F, 0x80, 0x07, 0x00, 0x0C, 0x00, 0x07, 0x03, 0x17, 0xDE, 0x66, 0x7B,
+};
+
+FontPageDef_t Font_11x18_Packed = {
+	11,
+	18,
+	32,
+	126,
+	Font_11x18_Packed_Data,
+	FONTS_FORMAT_PACKED,
+	Font_11x18_Packed_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
+
+static const uint16_t Font_16x26_Packed_Index[] = {
+	0x0000, 0x0003, 0x0014, 0x0021, 0x004E, 0x0077, 0x00A4, 0x00D1, 0x00D9, 0x0102, 0x012B, 0x0143,
+	0x0164, 0x016D, 0x0174, 0x017A, 0x01AF, 0x01DA, 0x0202, 0x0228, 0x024B, 0x0278, 0x029B, 0x02C6,
+	0x02EE, 0x0319, 0x0344, 0x0351, 0x0361, 0x0382, 0x0393, 0x03B4, 0x03DC, 0x0409, 0x0430, 0x0453,
+	0x0478, 0x049D, 0x04C0, 0x04E1, 0x0508, 0x052D, 0x0550, 0x056E, 0x0591, 0x05B4, 0x05DB, 0x0600,
+	0x0627, 0x064A, 0x0679, 0x069C, 0x06BF, 0x06E6, 0x070B, 0x0732, 0x0759, 0x0780, 0x07A7, 0x07CC,
+	0x07F2, 0x0824, 0x084A, 0x086D, 0x0874, 0x0878, 0x0898, 0x08C0, 0x08E0, 0x090B, 0x092B, 0x0956,
+	0x097F, 0x09A7, 0x09C7, 0x09F1, 0x0A19, 0x0A39, 0x0A5A, 0x0A78, 0x0A98, 0x0ABE, 0x0AE4, 0x0B00,
+	0x0B1C, 0x0B41, 0x0B5D, 0x0B7E, 0x0B9F, 0x0BBF, 0x0BEA, 0x0C0A, 0x0C36, 0x0C43, 0x0C6F,
+};
+
+static const uint8_t Font_16x26_Packed_Data[] = {
+	0x00, 0x00, 0x00, 0x00, 0x15, 0x64, 0xFF, 0x03, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F,
+	0xFE, 0x0F, 0xC0, 0x01, 0x00, 0x07, 0x3A, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+	0x1F, 0x00, 0x15, 0x0F, 0x00, 0x60, 0x00, 0x10, 0x0C, 0x00, 0x83, 0x71, 0x60, 0xF0, 0x0F, 0xEC,
+	0xFF, 0xC1, 0xFF, 0x9F, 0xFF, 0x3F, 0xF8, 0x7F, 0xC3, 0xFF, 0xE0, 0xFF, 0x98, 0xFF, 0x03, 0xFF,
+	0x7F, 0xFE, 0xFF, 0xF0, 0xFF, 0x07, 0xFE, 0xC1, 0xC0, 0x33, 0x18, 0x00, 0x06, 0x03, 0x00, 0x17,
+	0x2C, 0x00, 0x00, 0x0C, 0x7E, 0x00, 0x86, 0x7F, 0x00, 0xC7, 0x7F, 0x80, 0xF3, 0x7F, 0x80, 0x39,
+	0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xCF, 0x01, 0xFE,
+	0xE3, 0x00, 0xFF, 0x61, 0x00, 0x7F, 0x00, 0x00, 0x15, 0x0F, 0xFE, 0x01, 0xD8, 0x3F, 0x80, 0xFF,
+	0x0F, 0xFC, 0x81, 0xC1, 0x17, 0x20, 0x7C, 0x9E, 0xE7, 0xC3, 0xFF, 0x3E, 0xF0, 0xFF, 0x03, 0xFC,
+	0xFF, 0x07, 0xF0, 0xFF, 0x81, 0xEF, 0x7F, 0xF8, 0xFC, 0xCF, 0x8F, 0x81, 0x7D, 0x30, 0xF0, 0x07,
+	0xFE, 0x3F, 0xC0, 0xFF, 0x00, 0x15, 0x0F, 0x00, 0xF8, 0x03, 0x80, 0xFF, 0x00, 0xF0, 0x3F, 0x1C,
+	0xFF, 0xEF, 0xFF, 0xE0, 0xFF, 0x0F, 0xF8, 0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x83, 0xFF, 0xF8, 0xBF,
+	0xBF, 0xFF, 0xC7, 0x7F, 0x7F, 0xF0, 0xE7, 0x07, 0xF8, 0x01, 0xE0, 0x3F, 0x00, 0xFF, 0x07, 0xE0,
+	0xEF, 0x00, 0x07, 0x64, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x19, 0x4B, 0x00, 0xFF, 0x00, 0xC0,
+	0xFF, 0x0F, 0xC0, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0xC1, 0x1F, 0xF8, 0xC3, 0x07, 0x80, 0xCF, 0x03,
+	0x00, 0xBC, 0x03, 0x00, 0x70, 0x03, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x07, 0x00, 0x00, 0x0E, 0x00,
+	0x00, 0x0C, 0x00, 0x19, 0x1B, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
+	0x00, 0x7E, 0x00, 0x00, 0xEE, 0x01, 0x00, 0x9E, 0x0F, 0x00, 0x1F, 0xFE, 0xC0, 0x1F, 0xFC, 0xFF,
+	0x3F, 0xE0, 0xFF, 0x1F, 0x80, 0xFF, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x0C, 0x2D, 0x38, 0x80,
+	0x43, 0x38, 0x06, 0xF3, 0xF3, 0xFF, 0x7F, 0x1F, 0xF1, 0x3B, 0xF1, 0x0F, 0xFB, 0x38, 0x8F, 0x43,
+	0x38, 0x00, 0x03, 0x06, 0x0F, 0x0F, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+	0x0C, 0x00, 0x06, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x03, 0x11, 0x09, 0x64, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0x07, 0x0B, 0x02, 0x2C,
+	0xFF, 0xFF, 0xFF, 0x03, 0x11, 0x04, 0x64, 0xFF, 0xFF, 0x0F, 0x00, 0x19, 0x0F, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x07,
+	0x00, 0xFC, 0x03, 0x00, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x80, 0x7F, 0x00, 0xC0, 0x3F, 0x00, 0xE0,
+	0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0xC0, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+	0x15, 0x1E, 0xE0, 0xFF, 0x00, 0xFF, 0x7F, 0xF0, 0xFF, 0x1F, 0xFF, 0xFF, 0xF7, 0x07, 0xFC, 0x1F,
+	0x00, 0xFC, 0x01, 0x00, 0x1F, 0x00, 0xC0, 0x07, 0x00, 0xFC, 0x01, 0xC0, 0xFF, 0x01, 0x7F, 0xFF,
+	0xFF, 0xC7, 0xFF, 0x7F, 0xF0, 0xFF, 0x07, 0xF8, 0x3F, 0x00, 0x00, 0x15, 0x2D, 0x0C, 0x00, 0x98,
+	0x01, 0x00, 0x33, 0x00, 0x60, 0x07, 0x00, 0xEC, 0x00, 0x80, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01,
+	0x00, 0x30, 0x00, 0x15, 0x2C, 0x06, 0x00, 0xDE, 0x00, 0xE0, 0x1F, 0x00, 0xFE, 0x03, 0xF0, 0x3F,
+	0x00, 0xBF, 0x07, 0xF0, 0xF1, 0x00, 0x1F, 0x3E, 0xF0, 0xC1, 0xFF, 0x1F, 0xD8, 0xFF, 0x01, 0xFB,
+	0x1F, 0x60, 0xFE, 0x01, 0x0C, 0x07, 0x80, 0x01, 0x00, 0x15, 0x3B, 0x06, 0x00, 0xFC, 0xC0, 0x80,
+	0x1F, 0x18, 0xF0, 0x01, 0x03, 0x3C, 0x60, 0x80, 0x07, 0x0E, 0xF0, 0xC1, 0x03, 0xFF, 0xFF, 0xF0,
+	0xFF, 0xFF, 0xCF, 0xBF, 0xFF, 0xF1, 0xE3, 0x1F, 0x1C, 0xF8, 0x01, 0x00, 0x15, 0x0F, 0x00, 0x60,
+	0x00, 0x00, 0x0F, 0x00, 0xF0, 0x01, 0x80, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0xCF, 0x00, 0xFC, 0x18,
+	0xC0, 0x07, 0x03, 0x7E, 0x60, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x01, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x15, 0x3B, 0xFF, 0x03, 0xFC, 0x7F, 0x80,
+	0xFF, 0x0F, 0xF0, 0xFF, 0x01, 0x7C, 0x30, 0x80, 0x0F, 0x0E, 0xF0, 0xC1, 0x03, 0x3F, 0xF8, 0xFD,
+	0x07, 0xFE, 0xEF, 0xC0, 0xFF, 0x1D, 0xF0, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x15, 0x1E, 0x00, 0x0C,
+	0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x1F, 0xFE, 0xFF, 0xE7, 0xFF, 0xFF, 0x7C, 0x1C, 0xFE, 0xC3, 0x01,
+	0x3F, 0x18, 0xC0, 0x03, 0x03, 0x78, 0xE0, 0x80, 0x0F, 0x3C, 0xF8, 0x83, 0xFF, 0x77, 0xE0, 0xFF,
+	0x0C, 0xF8, 0x0F, 0x00, 0xFE, 0x00, 0x00, 0x15, 0x2D, 0x07, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x00,
+	0xFC, 0x03, 0xC0, 0x7F, 0x00, 0xFE, 0x0F, 0xF0, 0xFF, 0x81, 0xFF, 0x38, 0xF8, 0x03, 0xC7, 0x1F,
+	0xE0, 0xFE, 0x00, 0xFC, 0x07, 0x80, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x15,
+	0x1E, 0x00, 0xC0, 0x01, 0x06, 0xFE, 0xF0, 0xE3, 0x3F, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0x3F,
+	0xF8, 0xE1, 0x01, 0x1F, 0x78, 0xC0, 0x03, 0x0F, 0xF8, 0xF0, 0x83, 0xFF, 0xFF, 0xF9, 0xFF, 0xFE,
+	0xE7, 0x8F, 0xFF, 0xF8, 0xE0, 0x0F, 0x00, 0xF8, 0x00, 0x00, 0x15, 0x1E, 0xE0, 0x01, 0x00, 0xFF,
+	0x80, 0xF1, 0x3F, 0x70, 0xFF, 0x07, 0xFE, 0xFF, 0x81, 0x0F, 0x38, 0xF0, 0x00, 0x06, 0x1E, 0xC0,
+	0xE0, 0x07, 0x18, 0xFC, 0x81, 0xE3, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0x3F, 0xF0, 0xFF,
+	0x03, 0xF8, 0x0F, 0x00, 0x06, 0x0F, 0x64, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x80,
+	0x07, 0x06, 0x14, 0x64, 0x0F, 0x78, 0xFC, 0x80, 0xFF, 0x0F, 0xF8, 0xFF, 0x80, 0x7F, 0x0F, 0xF8,
+	0x03, 0x06, 0x0F, 0x0F, 0x80, 0x00, 0x40, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x1F, 0xC0,
+	0x1F, 0xE0, 0x0E, 0x38, 0x0E, 0x1C, 0x07, 0x07, 0x87, 0x83, 0xE3, 0x80, 0x73, 0xC0, 0x1D, 0xC0,
+	0x0F, 0xE0, 0x0A, 0x07, 0x0F, 0xE3, 0xF1, 0x78, 0x3C, 0x1E, 0x8F, 0xC7, 0xE3, 0xF1, 0x78, 0x3C,
+	0x1E, 0x8F, 0xC7, 0x06, 0x0F, 0x0F, 0x03, 0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01, 0xE7, 0x80, 0xE3,
+	0xE0, 0x70, 0x70, 0x70, 0x1C, 0x38, 0x0E, 0xB8, 0x03, 0xDC, 0x01, 0x7C, 0x00, 0x3E, 0x00, 0x0E,
+	0x00, 0x07, 0x00, 0x01, 0x00, 0x15, 0x2D, 0x1E, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0x80, 0x01,
+	0x30, 0x3E, 0x80, 0xC7, 0x07, 0xF8, 0xF8, 0x80, 0x1F, 0x1F, 0xF8, 0xE3, 0x87, 0x07, 0xE0, 0x7F,
+	0x00, 0xF8, 0x07, 0x00, 0x7F, 0x00, 0xC0, 0x07, 0x00, 0x30, 0x00, 0x00, 0x00, 0x15, 0x0F, 0x00,
+	0x3F, 0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x0F, 0xFE, 0xFF, 0xE3, 0x07, 0xF8, 0x3C, 0x00, 0xDC, 0xE3,
+	0x3F, 0x3F, 0xFE, 0xEF, 0xE3, 0xFF, 0x79, 0x3E, 0x38, 0xCF, 0x01, 0xE7, 0x1B, 0xF8, 0xFE, 0xE7,
+	0xCF, 0xFD, 0xFF, 0x9B, 0xFF, 0x7F, 0xC0, 0xFF, 0x0F, 0x03, 0x12, 0x0F, 0x00, 0x80, 0x03, 0x80,
+	0x0F, 0xC0, 0x3F, 0xC0, 0xFF, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0xBF, 0xC1, 0x1F, 0x06, 0x1F, 0x18,
+	0xFC, 0x63, 0xF0, 0xFF, 0x01, 0xFF, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x0F, 0xC0, 0x3F, 0x00, 0xFC,
+	0x03, 0x12, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x0C,
+	0x3C, 0x30, 0xF0, 0xE0, 0xC1, 0xC7, 0x07, 0xFF, 0x7F, 0xFE, 0xEF, 0xBF, 0x3F, 0x7F, 0x7C, 0xFC,
+	0x01, 0xE0, 0x03, 0x03, 0x12, 0x1E, 0xE0, 0x1F, 0xE0, 0xFF, 0xC1, 0xFF, 0x0F, 0xFF, 0x3F, 0x3E,
+	0xF8, 0x39, 0x80, 0x77, 0x00, 0xFC, 0x01, 0xE0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00,
+	0xC0, 0x07, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x38, 0x03, 0x12, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x07, 0x80, 0x1F,
+	0x00, 0xFE, 0x01, 0x9E, 0xFF, 0x7F, 0xFE, 0xFF, 0xF0, 0xFF, 0x83, 0xFF, 0x03, 0x03, 0x12, 0x2D,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+	0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x00, 0x0C,
+	0x03, 0x12, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x0C,
+	0x30, 0x30, 0xC0, 0xC0, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x03, 0x03,
+	0x00, 0x03, 0x12, 0x0F, 0x80, 0x07, 0xC0, 0xFF, 0x80, 0xFF, 0x07, 0xFF, 0x3F, 0xFE, 0xFF, 0xF9,
+	0xC0, 0xF7, 0x00, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x18, 0x3C, 0x60, 0xF0, 0x80, 0xC1, 0x03,
+	0xFE, 0x1F, 0xF8, 0x7F, 0xE0, 0xBF, 0x81, 0x7F, 0x03, 0x12, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00,
+	0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x12, 0x2D,
+	0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x0C,
+	0x03, 0x12, 0x2B, 0x00, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00,
+	0x3C, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x07, 0x03, 0x12,
+	0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x80, 0x3F, 0x00, 0xFF,
+	0x01, 0xBE, 0x1F, 0x7C, 0xFC, 0x7C, 0xE0, 0xF7, 0x00, 0xFE, 0x01, 0xF0, 0x03, 0x80, 0x07, 0x00,
+	0x0C, 0x03, 0x12, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+	0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00,
+	0x00, 0x03, 0x00, 0x0C, 0x03, 0x12, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x01, 0xF8, 0x1F, 0x80, 0xFF, 0x03, 0xF0, 0x0F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0xC1,
+	0xFF, 0x00, 0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x12, 0x1E, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x80, 0x7F, 0x00, 0xF8, 0x07,
+	0x80, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x03, 0x12, 0x0F, 0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0xFF, 0x8F, 0xFF, 0x7F, 0xFE, 0xFF, 0x3D, 0x00,
+	0x7F, 0x00, 0xF8, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF0, 0xFE, 0xFF,
+	0xF9, 0xFF, 0xC7, 0xFF, 0x0F, 0xFE, 0x1F, 0x03, 0x12, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x01, 0x03, 0x07, 0x1C, 0x1E,
+	0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x01, 0xF8, 0x07, 0x00, 0x03, 0x16, 0x0F, 0xC0, 0x0F, 0x00,
+	0xFE, 0x1F, 0xC0, 0xFF, 0x0F, 0xF8, 0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x03, 0xF0, 0x70, 0x00, 0x38,
+	0x0C, 0x00, 0x0C, 0x03, 0x00, 0xC3, 0x00, 0xC0, 0x71, 0x00, 0xF8, 0x3C, 0x00, 0x3F, 0xFE, 0xFF,
+	0x9F, 0xFF, 0x7F, 0xC7, 0xFF, 0x8F, 0xE3, 0xFF, 0xE1, 0x03, 0x12, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x38, 0x30, 0xF0, 0xC1, 0xC1, 0x0F, 0xCF, 0x7F,
+	0xFC, 0xEF, 0xE7, 0x1F, 0xBF, 0x7F, 0xF8, 0x7C, 0xC0, 0x03, 0x00, 0x0C, 0x03, 0x12, 0x2D, 0x7C,
+	0xC0, 0xF9, 0x03, 0xEE, 0x1F, 0xF8, 0x7F, 0xE0, 0xC7, 0x03, 0x0F, 0x0E, 0x3C, 0x38, 0xF0, 0xE0,
+	0xC1, 0x03, 0x87, 0x0F, 0x3C, 0x7F, 0xF0, 0xDF, 0x81, 0x7F, 0x06, 0xFE, 0x00, 0xF0, 0x01, 0x03,
+	0x12, 0x0F, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0xF0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x0C,
+	0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x12, 0x1E, 0xFF, 0x1F, 0xFC, 0xFF, 0xF3, 0xFF, 0xDF,
+	0xFF, 0x7F, 0xFF, 0xFF, 0x03, 0x00, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0E,
+	0x00, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0x01, 0x03, 0x12, 0x0F, 0x07, 0x00,
+	0x7C, 0x00, 0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFC, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x3F, 0x80, 0xFF,
+	0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x0F, 0xF0, 0x0F, 0xC0,
+	0x07, 0x00, 0x03, 0x12, 0x0F, 0x7F, 0x00, 0xFC, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0xFF,
+	0x03, 0xF8, 0x0F, 0xFF, 0x3F, 0xFC, 0x1F, 0xF0, 0x07, 0xC0, 0xFF, 0x01, 0xFF, 0x3F, 0xC0, 0xFF,
+	0x00, 0xFC, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x12, 0x0F, 0x01, 0x00, 0x0E, 0x00,
+	0xFE, 0x00, 0xFC, 0x07, 0xF8, 0x3F, 0xF8, 0xF9, 0xF3, 0xC1, 0xFF, 0x03, 0xFC, 0x07, 0xE0, 0x0F,
+	0x80, 0xFF, 0x80, 0xFF, 0x07, 0x1F, 0x3F, 0x3E, 0xF8, 0x7F, 0xC0, 0xFF, 0x00, 0xFC, 0x00, 0xE0,
+	0x03, 0x12, 0x0F, 0x01, 0x00, 0x1C, 0x00, 0xF0, 0x01, 0xC0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x07,
+	0x00, 0xFF, 0x3F, 0xF8, 0xFF, 0x80, 0xFF, 0x03, 0xFF, 0x0F, 0xFE, 0x3F, 0x7E, 0x00, 0xFC, 0x00,
+	0xFC, 0x00, 0xF0, 0x01, 0xC0, 0x01, 0x00, 0x03, 0x12, 0x1E, 0x03, 0x80, 0x0F, 0x00, 0x3F, 0x00,
+	0xFE, 0x00, 0xFE, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xF0, 0xF1, 0xF0, 0xC3, 0xE3, 0x07, 0xCF, 0x0F,
+	0xBC, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x30, 0x00, 0x19, 0x5A, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x38, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x06, 0x00, 0x19, 0x1E, 0x03, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x07,
+	0x00, 0xC0, 0x3F, 0x00, 0x00, 0xFE, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xFC,
+	0x03, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0x1F, 0x00, 0x00,
+	0x3E, 0x00, 0x00, 0x70, 0x00, 0x19, 0x1A, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00,
+	0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x11, 0x1E, 0x00, 0x80, 0x01,
+	0xE0, 0x03, 0xF0, 0x07, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0x00, 0xFF, 0x01,
+	0xF0, 0x1F, 0x80, 0xFF, 0x00, 0xFC, 0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x70, 0x15, 0x02, 0x0F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x83, 0x0F, 0x06, 0x0F, 0x1E, 0x00, 0x1E, 0x83, 0x9F, 0xE1,
+	0xFF, 0xF0, 0x7F, 0xBC, 0x1F, 0x0E, 0x0F, 0x83, 0x87, 0xC1, 0xC7, 0xF0, 0xFF, 0xDF, 0xFF, 0xEF,
+	0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03, 0x80, 0x01, 0x00, 0x15, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x38, 0xC0, 0x81, 0x03, 0x38, 0x30, 0x00, 0x06, 0x06, 0xC0,
+	0xC0, 0x01, 0x1C, 0x78, 0xE0, 0x03, 0xFF, 0x3F, 0xC0, 0xFF, 0x07, 0xF8, 0x7F, 0x00, 0xFC, 0x03,
+	0x06, 0x0F, 0x1E, 0xC0, 0x01, 0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xFB, 0xE0, 0x1F, 0xC0,
+	0x0F, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1B, 0xC0, 0x00,
+	0x00, 0x15, 0x1E, 0x00, 0xFC, 0x01, 0xE0, 0xFF, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x0F, 0xFC, 0xF9,
+	0x81, 0x03, 0x38, 0x30, 0x00, 0x06, 0x06, 0xC0, 0xC0, 0x00, 0x1C, 0x38, 0xC0, 0xFD, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x06, 0x0F, 0x1E, 0xE0, 0x03,
+	0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0x7B, 0xC6, 0x1F, 0xC3, 0x87, 0xC1, 0xC3, 0xE0, 0x63,
+	0xF0, 0x3F, 0xF8, 0x1F, 0xEC, 0x0F, 0xE7, 0x87, 0xC3, 0xC3, 0x00, 0x00, 0x15, 0x1E, 0xC0, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x80, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x18, 0x00, 0x04, 0x03, 0x80, 0x60, 0x00, 0x10, 0x0C, 0x00,
+	0x82, 0x01, 0xC0, 0x30, 0x00, 0x00, 0x06, 0x14, 0x1E, 0xF0, 0x07, 0xC0, 0xFF, 0xC1, 0xFE, 0x3F,
+	0xEC, 0xFF, 0xC7, 0x3F, 0x7E, 0x78, 0x00, 0x87, 0x03, 0x60, 0x38, 0x00, 0x86, 0x07, 0x70, 0x7C,
+	0x80, 0xC3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x3F, 0xFF, 0x7F, 0x00, 0x00,
+	0x15, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x78, 0x00, 0x80,
+	0x07, 0x00, 0x70, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0,
+	0xFF, 0x0F, 0xF8, 0xFF, 0x01, 0xFC, 0x3F, 0x00, 0x15, 0x1A, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00,
+	0x03, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01, 0xC0, 0xF0, 0xFF, 0x1F, 0xFE, 0xFF, 0xC3,
+	0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00,
+	0x0C, 0x0C, 0x00, 0x30, 0x30, 0x00, 0x80, 0xC0, 0x00, 0x00, 0x02, 0x03, 0x00, 0x08, 0x0C, 0x00,
+	0xF0, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFC, 0xFF, 0xDF, 0xF0, 0xFF,
+	0x1F, 0x00, 0x15, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+	0x07, 0x00, 0xF8, 0x01, 0x80, 0x7F, 0x00, 0xF8, 0x1F, 0x80, 0xCF, 0x07, 0xF8, 0xF0, 0x03, 0x0F,
+	0x7C, 0xE0, 0x00, 0x0F, 0x0C, 0xC0, 0x81, 0x00, 0x30, 0x00, 0x15, 0x1A, 0x01, 0x00, 0x20, 0x00,
+	0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x06, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x78, 0x00, 0x7C, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0xBF, 0x0F,
+	0xE0, 0x01, 0xF0, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x06, 0x0F, 0x2D, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x78, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x80, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03, 0x06, 0x0F, 0x1E, 0xF0, 0x07, 0xFE, 0x8F, 0xFF,
+	0xCF, 0xFF, 0xF7, 0xC1, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF8, 0x07, 0xDF,
+	0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xE0, 0x3F, 0x00, 0x06, 0x14, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x78, 0x70, 0x00, 0x07, 0x03, 0x60, 0x30, 0x00, 0x06, 0x07,
+	0x70, 0xF0, 0xC0, 0x07, 0xFF, 0x7F, 0xE0, 0xFF, 0x03, 0xFE, 0x1F, 0x80, 0x7F, 0x00, 0x06, 0x14,
+	0x1D, 0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFE, 0x3F, 0xE0, 0xFF, 0x07, 0x1F, 0x7C, 0x70, 0x00, 0x07,
+	0x03, 0x60, 0x30, 0x00, 0x06, 0x07, 0x70, 0x70, 0x80, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x0F, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF7, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0x00,
+	0x06, 0x0F, 0x2C, 0x38, 0x30, 0x3F, 0xB8, 0x1F, 0xFC, 0x1F, 0xFE, 0x0F, 0x1E, 0x07, 0x0F, 0x87,
+	0x87, 0xC3, 0xC3, 0xF3, 0xC1, 0xFF, 0xE1, 0xEF, 0xF0, 0x67, 0xF0, 0x01, 0x03, 0x12, 0x1E, 0x18,
+	0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x18, 0x80, 0x63, 0x00, 0x8C, 0x01, 0x30, 0x06, 0xC0, 0x18, 0x00, 0x63, 0x00, 0x8C, 0x01,
+	0x30, 0x06, 0x0F, 0x2C, 0xFF, 0x9F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x07, 0x00, 0x03,
+	0xC0, 0x01, 0xF0, 0x00, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x06, 0x0F, 0x0F,
+	0x01, 0x80, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x00,
+	0x7C, 0x80, 0x3F, 0xF0, 0x1F, 0xFF, 0xE3, 0x3F, 0xF8, 0x07, 0xFC, 0x00, 0x0E, 0x00, 0x06, 0x0F,
+	0x0F, 0x3F, 0x80, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFC, 0x07, 0xFE, 0xF3, 0xFF, 0xFD, 0x0F,
+	0x7E, 0x00, 0xFF, 0x83, 0xFF, 0x1F, 0xFE, 0x0F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06,
+	0x0F, 0x1E, 0x01, 0xC0, 0x03, 0xF8, 0x03, 0xFE, 0x83, 0xFF, 0xF7, 0xF3, 0xFF, 0xE0, 0x1F, 0xE0,
+	0x0F, 0xF0, 0x0F, 0xFE, 0x8F, 0xDF, 0xFF, 0xC3, 0xFF, 0x80, 0x1F, 0x80, 0x07, 0x80, 0x01, 0x06,
+	0x14, 0x0F, 0x01, 0x00, 0x70, 0x00, 0x80, 0x1F, 0x00, 0xF8, 0x0F, 0x80, 0xFF, 0x03, 0xCC, 0xFF,
+	0xE0, 0xE0, 0xFF, 0x0F, 0xF8, 0xFF, 0x00, 0xFE, 0x07, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x00,
+	0xFE, 0x03, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0x70, 0x00, 0x00, 0x06, 0x0F, 0x1E, 0x00, 0xE0, 0x01,
+	0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0x7C, 0x0F, 0x9F, 0xC7, 0xC7, 0xF3, 0xE1, 0x7D, 0xF0,
+	0x1F, 0xF8, 0x07, 0xFC, 0x01, 0x7E, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x19, 0x2C, 0x00, 0x18, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF, 0xDF,
+	0xFF, 0xFF, 0xBF, 0xFF, 0xF3, 0xFF, 0xC3, 0x81, 0xC3, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E,
+	0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x19, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x07, 0x00, 0x19, 0x2C, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E,
+	0x00, 0x00, 0x3C, 0x18, 0x18, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x3E,
+	0x3C, 0x7C, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x00, 0x0B,
+	0x05, 0x0F, 0xD8, 0xFF, 0x3F, 0xC6, 0x79, 0xCE, 0x73, 0x8C, 0xFF, 0x7F,
+};
+
+FontPageDef_t Font_16x26_Packed = {
+	16,
+	26,
+	32,
+	126,
+	Font_16x26_Packed_Data,
+	FONTS_FORMAT_PACKED,
+	Font_16x26_Packed_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
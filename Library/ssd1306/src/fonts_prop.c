@@ -0,0 +1,705 @@
+/**
+ ******************************************************************************
+ * @file    fonts_prop.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Generated by Tools/fonttool.py, do not edit.
+ *
+ * Flash usage in bytes:
+ * font           uint16     page   packed      rle     prop
+ * Font_7x10        1900     1330      857     1075     1198
+ * Font_11x18       3420     3135     1580     2084     2122
+ * Font_16x26       4940     6080     3386     3436     4280
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const FontGlyphDef_t Font_7x10_Prop_Glyphs[] = {
+	{ 0, 4, 0, 0, 0, 0 },
+	{ 0, 2, 0, 0, 1, 8 },
+	{ 1, 4, 0, 0, 3, 3 },
+	{ 4, 6, 0, 0, 5, 8 },
+	{ 9, 6, 0, 0, 5, 9 },
+	{ 19, 6, 0, 0, 5, 8 },
+	{ 24, 6, 0, 0, 5, 8 },
+	{ 29, 2, 0, 0, 1, 3 },
+	{ 30, 4, 0, 0, 3, 10 },
+	{ 36, 4, 0, 0, 3, 10 },
+	{ 42, 4, 0, 0, 3, 4 },
+	{ 45, 6, 0, 2, 5, 5 },
+	{ 50, 2, 0, 7, 1, 3 },
+	{ 51, 4, 0, 5, 3, 1 },
+	{ 54, 2, 0, 7, 1, 1 },
+	{ 55, 4, 0, 0, 3, 8 },
+	{ 58, 6, 0, 0, 5, 8 },
+	{ 63, 4, 0, 0, 3, 8 },
+	{ 66, 6, 0, 0, 5, 8 },
+	{ 71, 6, 0, 0, 5, 8 },
+	{ 76, 6, 0, 0, 5, 8 },
+	{ 81, 6, 0, 0, 5, 8 },
+	{ 86, 6, 0, 0, 5, 8 },
+	{ 91, 6, 0, 0, 5, 8 },
+	{ 96, 6, 0, 0, 5, 8 },
+	{ 101, 6, 0, 0, 5, 8 },
+	{ 106, 2, 0, 2, 1, 6 },
+	{ 107, 2, 0, 3, 1, 7 },
+	{ 108, 6, 0, 2, 5, 5 },
+	{ 113, 6, 0, 3, 5, 3 },
+	{ 118, 6, 0, 2, 5, 5 },
+	{ 123, 6, 0, 0, 5, 8 },
+	{ 128, 6, 0, 0, 5, 8 },
+	{ 133, 6, 0, 0, 5, 8 },
+	{ 138, 6, 0, 0, 5, 8 },
+	{ 143, 6, 0, 0, 5, 8 },
+	{ 148, 6, 0, 0, 5, 8 },
+	{ 153, 6, 0, 0, 5, 8 },
+	{ 158, 6, 0, 0, 5, 8 },
+	{ 163, 6, 0, 0, 5, 8 },
+	{ 168, 6, 0, 0, 5, 8 },
+	{ 173, 4, 0, 0, 3, 8 },
+	{ 176, 6, 0, 0, 5, 8 },
+	{ 181, 6, 0, 0, 5, 8 },
+	{ 186, 6, 0, 0, 5, 8 },
+	{ 191, 6, 0, 0, 5, 8 },
+	{ 196, 6, 0, 0, 5, 8 },
+	{ 201, 6, 0, 0, 5, 8 },
+	{ 206, 6, 0, 0, 5, 8 },
+	{ 211, 6, 0, 0, 5, 9 },
+	{ 221, 6, 0, 0, 5, 8 },
+	{ 226, 6, 0, 0, 5, 8 },
+	{ 231, 6, 0, 0, 5, 8 },
+	{ 236, 6, 0, 0, 5, 8 },
+	{ 241, 6, 0, 0, 5, 8 },
+	{ 246, 6, 0, 0, 5, 8 },
+	{ 251, 6, 0, 0, 5, 8 },
+	{ 256, 6, 0, 0, 5, 8 },
+	{ 261, 6, 0, 0, 5, 8 },
+	{ 266, 3, 0, 0, 2, 10 },
+	{ 270, 4, 0, 0, 3, 8 },
+	{ 273, 3, 0, 0, 2, 10 },
+	{ 277, 6, 0, 0, 5, 4 },
+	{ 282, 8, 0, 9, 7, 1 },
+	{ 289, 3, 0, 0, 2, 2 },
+	{ 291, 6, 0, 2, 5, 6 },
+	{ 296, 6, 0, 0, 5, 8 },
+	{ 301, 6, 0, 2, 5, 6 },
+	{ 306, 6, 0, 0, 5, 8 },
+	{ 311, 6, 0, 2, 5, 6 },
+	{ 316, 6, 0, 0, 5, 8 },
+	{ 321, 6, 0, 2, 5, 8 },
+	{ 326, 6, 0, 0, 5, 8 },
+	{ 331, 4, 0, 0, 3, 8 },
+	{ 334, 5, 0, 0, 4, 10 },
+	{ 342, 6, 0, 0, 5, 8 },
+	{ 347, 4, 0, 0, 3, 8 },
+	{ 350, 6, 0, 2, 5, 6 },
+	{ 355, 6, 0, 2, 5, 6 },
+	{ 360, 6, 0, 2, 5, 6 },
+	{ 365, 6, 0, 2, 5, 8 },
+	{ 370, 6, 0, 2, 5, 8 },
+	{ 375, 6, 0, 2, 5, 6 },
+	{ 380, 6, 0, 2, 5, 6 },
+	{ 385, 5, 0, 0, 4, 8 },
+	{ 389, 6, 0, 2, 5, 6 },
+	{ 394, 6, 0, 2, 5, 6 },
+	{ 399, 6, 0, 2, 5, 6 },
+	{ 404, 6, 0, 2, 5, 6 },
+	{ 409, 6, 0, 2, 5, 8 },
+	{ 414, 6, 0, 2, 5, 6 },
+	{ 419, 4, 0, 0, 3, 10 },
+	{ 425, 2, 0, 0, 1, 10 },
+	{ 427, 4, 0, 0, 3, 10 },
+	{ 433, 6, 0, 3, 5, 2 },
+};
+
+static const uint8_t Font_7x10_Prop_Data[] = {
+	0xBF, 0x07, 0x00, 0x07, 0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x66, 0x89, 0xFF, 0x89, 0x72, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x26, 0x19, 0x6E, 0x94, 0x62, 0x60, 0x96, 0x99, 0x66, 0x90, 0x07, 0xFC, 0x02,
+	0x01, 0x00, 0x01, 0x02, 0x01, 0x02, 0xFC, 0x02, 0x01, 0x00, 0x0A, 0x07, 0x0A, 0x04, 0x04, 0x1F,
+	0x04, 0x04, 0x07, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x3C, 0x03, 0x7E, 0x81, 0x89, 0x81, 0x7E, 0x04,
+	0x02, 0xFF, 0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x42, 0x81, 0x89, 0x89, 0x76, 0x30, 0x2C, 0x22, 0xFF,
+	0x20, 0x4F, 0x89, 0x89, 0x89, 0x71, 0x7E, 0x89, 0x89, 0x89, 0x72, 0x01, 0xE1, 0x19, 0x05, 0x03,
+	0x76, 0x89, 0x89, 0x89, 0x76, 0x4E, 0x91, 0x91, 0x91, 0x7E, 0x21, 0x71, 0x04, 0x0A, 0x0A, 0x11,
+	0x11, 0x05, 0x05, 0x05, 0x05, 0x05, 0x11, 0x11, 0x0A, 0x0A, 0x04, 0x02, 0x01, 0xB1, 0x09, 0x06,
+	0x7E, 0x81, 0x99, 0x95, 0x1E, 0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0xFF, 0x89, 0x89, 0x89, 0x76, 0x7E,
+	0x81, 0x81, 0x81, 0x42, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0xFF, 0x89, 0x89, 0x89, 0x89, 0xFF, 0x09,
+	0x09, 0x09, 0x01, 0x7E, 0x81, 0x91, 0x91, 0x72, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x81, 0xFF, 0x81,
+	0x40, 0x80, 0x80, 0x80, 0x7F, 0xFF, 0x08, 0x14, 0x62, 0x81, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xFF,
+	0x06, 0x08, 0x06, 0xFF, 0xFF, 0x06, 0x18, 0x60, 0xFF, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0xFF, 0x11,
+	0x11, 0x11, 0x0E, 0x7E, 0x81, 0xC1, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x11, 0x11,
+	0x71, 0x8E, 0x46, 0x89, 0x89, 0x91, 0x62, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x7F, 0x80, 0x80, 0x80,
+	0x7F, 0x07, 0x38, 0xC0, 0x38, 0x07, 0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x81, 0x66, 0x18, 0x66, 0x81,
+	0x03, 0x0C, 0xF0, 0x0C, 0x03, 0xC1, 0xA1, 0x99, 0x85, 0x83, 0xFF, 0x01, 0x03, 0x02, 0x03, 0x3C,
+	0xC0, 0x01, 0xFF, 0x02, 0x03, 0x08, 0x06, 0x01, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x02, 0x1A, 0x25, 0x25, 0x15, 0x3E, 0xFF, 0x48, 0x84, 0x84, 0x78, 0x1E, 0x21, 0x21,
+	0x21, 0x12, 0x78, 0x84, 0x84, 0x48, 0xFF, 0x1E, 0x25, 0x25, 0x25, 0x16, 0x04, 0x04, 0xFE, 0x05,
+	0x05, 0x9E, 0xA1, 0xA1, 0x92, 0x7F, 0xFF, 0x08, 0x04, 0x04, 0xF8, 0x04, 0x04, 0xFD, 0x00, 0x04,
+	0x04, 0xFD, 0x02, 0x02, 0x02, 0x01, 0xFF, 0x10, 0x28, 0x44, 0x80, 0x01, 0x01, 0xFF, 0x3F, 0x01,
+	0x3F, 0x01, 0x3E, 0x3F, 0x02, 0x01, 0x01, 0x3E, 0x1E, 0x21, 0x21, 0x21, 0x1E, 0xFF, 0x12, 0x21,
+	0x21, 0x1E, 0x1E, 0x21, 0x21, 0x12, 0xFF, 0x3F, 0x02, 0x01, 0x01, 0x02, 0x12, 0x25, 0x25, 0x29,
+	0x12, 0x04, 0x7F, 0x84, 0x84, 0x1F, 0x20, 0x20, 0x10, 0x3F, 0x03, 0x1C, 0x20, 0x1C, 0x03, 0x0F,
+	0x38, 0x07, 0x38, 0x0F, 0x21, 0x12, 0x0C, 0x12, 0x21, 0x83, 0x8C, 0x70, 0x0C, 0x03, 0x31, 0x29,
+	0x25, 0x23, 0x21, 0x30, 0xCF, 0x01, 0x00, 0x03, 0x02, 0xFF, 0x03, 0x01, 0xCF, 0x30, 0x02, 0x03,
+	0x00, 0x03, 0x01, 0x01, 0x02, 0x03,
+};
+
+FontPageDef_t Font_7x10_Prop = {
+	8,
+	10,
+	32,
+	126,
+	Font_7x10_Prop_Data,
+	FONTS_FORMAT_PAGE,
+	NULL,
+	NULL,
+	95,
+	Font_7x10_Prop_Glyphs,
+	8
+};
+
+static const FontGlyphDef_t Font_11x18_Prop_Glyphs[] = {
+	{ 0, 6, 0, 0, 0, 0 },
+	{ 0, 3, 0, 1, 2, 14 },
+	{ 4, 6, 0, 1, 5, 5 },
+	{ 9, 10, 0, 1, 9, 14 },
+	{ 27, 9, 0, 1, 8, 16 },
+	{ 43, 11, 0, 1, 10, 14 },
+	{ 63, 10, 0, 1, 9, 14 },
+	{ 81, 3, 0, 1, 2, 5 },
+	{ 83, 6, 0, 0, 5, 18 },
+	{ 98, 6, 0, 0, 5, 18 },
+	{ 113, 7, 0, 1, 6, 5 },
+	{ 119, 11, 0, 3, 10, 10 },
+	{ 139, 3, 0, 13, 2, 5 },
+	{ 141, 5, 0, 9, 4, 2 },
+	{ 145, 3, 0, 13, 2, 2 },
+	{ 147, 6, 0, 1, 5, 14 },
+	{ 157, 9, 0, 1, 8, 14 },
+	{ 173, 6, 0, 1, 5, 14 },
+	{ 183, 9, 0, 1, 8, 14 },
+	{ 199, 9, 0, 1, 8, 14 },
+	{ 215, 9, 0, 1, 8, 14 },
+	{ 231, 9, 0, 1, 8, 14 },
+	{ 247, 9, 0, 1, 8, 14 },
+	{ 263, 9, 0, 1, 8, 14 },
+	{ 279, 9, 0, 1, 8, 14 },
+	{ 295, 9, 0, 1, 8, 14 },
+	{ 311, 3, 0, 5, 2, 10 },
+	{ 315, 3, 0, 6, 2, 12 },
+	{ 319, 9, 0, 4, 8, 9 },
+	{ 335, 9, 0, 5, 8, 6 },
+	{ 343, 9, 0, 4, 8, 9 },
+	{ 359, 10, 0, 1, 9, 14 },
+	{ 377, 9, 0, 1, 8, 14 },
+	{ 393, 10, 0, 1, 9, 14 },
+	{ 411, 9, 0, 1, 8, 14 },
+	{ 427, 9, 0, 1, 8, 14 },
+	{ 443, 9, 0, 1, 8, 14 },
+	{ 459, 9, 0, 1, 8, 14 },
+	{ 475, 9, 0, 1, 8, 14 },
+	{ 491, 9, 0, 1, 8, 14 },
+	{ 507, 9, 0, 1, 8, 14 },
+	{ 523, 7, 0, 1, 6, 14 },
+	{ 535, 9, 0, 1, 8, 14 },
+	{ 551, 10, 0, 1, 9, 14 },
+	{ 569, 9, 0, 1, 8, 14 },
+	{ 585, 10, 0, 1, 9, 14 },
+	{ 603, 9, 0, 1, 8, 14 },
+	{ 619, 9, 0, 1, 8, 14 },
+	{ 635, 9, 0, 1, 8, 14 },
+	{ 651, 10, 0, 1, 9, 14 },
+	{ 669, 10, 0, 1, 9, 14 },
+	{ 687, 9, 0, 1, 8, 14 },
+	{ 703, 11, 0, 1, 10, 14 },
+	{ 723, 9, 0, 1, 8, 14 },
+	{ 739, 10, 0, 1, 9, 14 },
+	{ 757, 11, 0, 1, 10, 14 },
+	{ 777, 11, 0, 1, 10, 14 },
+	{ 797, 11, 0, 1, 10, 14 },
+	{ 817, 9, 0, 1, 8, 14 },
+	{ 833, 5, 0, 0, 4, 18 },
+	{ 845, 6, 0, 1, 5, 14 },
+	{ 855, 5, 0, 0, 4, 18 },
+	{ 867, 9, 0, 1, 8, 8 },
+	{ 875, 12, 0, 16, 11, 1 },
+	{ 886, 5, 0, 1, 4, 3 },
+	{ 890, 10, 0, 5, 9, 10 },
+	{ 908, 9, 0, 1, 8, 14 },
+	{ 924, 9, 0, 5, 8, 10 },
+	{ 940, 9, 0, 1, 8, 14 },
+	{ 956, 9, 0, 5, 8, 10 },
+	{ 972, 10, 0, 1, 9, 14 },
+	{ 990, 9, 0, 4, 8, 14 },
+	{ 1006, 9, 0, 1, 8, 14 },
+	{ 1022, 6, 0, 1, 5, 14 },
+	{ 1032, 7, 0, 0, 6, 18 },
+	{ 1050, 10, 0, 1, 9, 14 },
+	{ 1068, 6, 0, 1, 5, 14 },
+	{ 1078, 11, 0, 5, 10, 10 },
+	{ 1098, 9, 0, 5, 8, 10 },
+	{ 1114, 9, 0, 5, 8, 10 },
+	{ 1130, 9, 0, 4, 8, 14 },
+	{ 1146, 9, 0, 4, 8, 14 },
+	{ 1162, 9, 0, 5, 8, 10 },
+	{ 1178, 9, 0, 5, 8, 10 },
+	{ 1194, 9, 0, 2, 8, 13 },
+	{ 1210, 9, 0, 5, 8, 10 },
+	{ 1226, 10, 0, 5, 9, 10 },
+	{ 1244, 10, 0, 5, 9, 10 },
+	{ 1262, 9, 0, 5, 8, 10 },
+	{ 1278, 9, 0, 4, 8, 14 },
+	{ 1294, 10, 0, 5, 9, 10 },
+	{ 1312, 7, 0, 0, 6, 18 },
+	{ 1330, 3, 0, 0, 2, 18 },
+	{ 1336, 7, 0, 0, 6, 18 },
+	{ 1354, 9, 0, 7, 8, 3 },
+};
+
+static const uint8_t Font_11x18_Prop_Data[] = {
+	0xFF, 0xFF, 0x37, 0x37, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x30, 0xB0, 0xFF, 0x7F, 0x30, 0xB0, 0xFF,
+	0x7F, 0x30, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x1C, 0x3E, 0x77, 0x63, 0xFF,
+	0xC3, 0x8E, 0x0C, 0x0E, 0x1E, 0x38, 0x30, 0xFF, 0x30, 0x1F, 0x0F, 0x1E, 0x3F, 0x21, 0x3F, 0x9E,
+	0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x06, 0x03, 0x01, 0x1E, 0x3F, 0x21, 0x3F, 0x1E, 0x00,
+	0x9E, 0xBF, 0xE3, 0xE3, 0x3F, 0x1E, 0x80, 0x80, 0x0F, 0x1F, 0x30, 0x30, 0x31, 0x1B, 0x0E, 0x3F,
+	0x11, 0x1F, 0x1F, 0xC0, 0xF8, 0x1C, 0x06, 0x01, 0x0F, 0x7F, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x01, 0x06, 0x1C, 0xF8, 0xC0, 0x00, 0x80, 0xE0, 0x7F, 0x0F, 0x02, 0x01, 0x00, 0x00,
+	0x00, 0x16, 0x1C, 0x0F, 0x0F, 0x1C, 0x16, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0F, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x80, 0xF8, 0x7F, 0x07, 0x38, 0x3F, 0x07, 0x00, 0x00, 0xF8, 0xFE, 0x07,
+	0xC3, 0xC3, 0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x18, 0x0C, 0x06,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC7, 0x7E, 0x3C, 0x38,
+	0x3C, 0x36, 0x33, 0x31, 0x30, 0x30, 0x30, 0x0C, 0x0E, 0x03, 0x63, 0x63, 0xFE, 0x9C, 0x00, 0x0C,
+	0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0xC0, 0xF8, 0x1E, 0xFF, 0xFF, 0x00, 0x00, 0x07,
+	0x07, 0x06, 0x06, 0x3F, 0x3F, 0x06, 0x06, 0xFF, 0xFF, 0x43, 0x63, 0x63, 0xE3, 0xC3, 0x80, 0x0C,
+	0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xF8, 0xFE, 0xC7, 0x63, 0x63, 0xE7, 0xCE, 0x8C, 0x07,
+	0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x03, 0x03, 0x03, 0x83, 0xE3, 0x7B, 0x1F, 0x07, 0x00,
+	0x00, 0x38, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x1C, 0xBE, 0xC3, 0xC3, 0xC3, 0xC7, 0xBE, 0x1C, 0x0F,
+	0x1F, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x0F, 0x7C, 0xFE, 0xC7, 0x83, 0x83, 0xC7, 0xFE, 0xF8, 0x0C,
+	0x1C, 0x39, 0x31, 0x31, 0x38, 0x1F, 0x07, 0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x09, 0x07, 0x10,
+	0x38, 0x28, 0x6C, 0x44, 0xC6, 0x82, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x83, 0x82, 0xC6, 0x44, 0x6C, 0x28, 0x38, 0x10, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x07, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C,
+	0x00, 0x00, 0x00, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x0F, 0xE3, 0xE3, 0x33, 0xFE,
+	0xFC, 0x07, 0x1F, 0x38, 0x31, 0x33, 0x1B, 0x03, 0x03, 0x00, 0xC0, 0xFC, 0x3F, 0x03, 0x3F, 0xFC,
+	0xC0, 0x00, 0x38, 0x3F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x3F, 0x38, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3,
+	0xFE, 0x3C, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0E, 0xF8, 0xFE, 0x07, 0x03, 0x03,
+	0x03, 0x0E, 0x0C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x1C, 0x0C, 0xFF, 0xFF, 0x03, 0x03, 0x03,
+	0x0E, 0xFE, 0xF8, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x1C, 0x0F, 0x03, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3,
+	0xC3, 0xC3, 0x03, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3,
+	0xC3, 0xC3, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0x07, 0x03, 0x03,
+	0x83, 0x8E, 0x8C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x31, 0x1F, 0x1F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x03, 0x03, 0xFF, 0xFF, 0x03,
+	0x03, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0E,
+	0x1E, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xFF, 0xFF, 0xC0, 0xE0, 0xB8, 0x1C, 0x06, 0x03, 0x01,
+	0x3F, 0x3F, 0x00, 0x00, 0x03, 0x07, 0x1C, 0x38, 0x20, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x0F, 0x7C, 0xC0, 0x7C, 0x07,
+	0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0xE0,
+	0x00, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0x3E, 0x3F, 0x3F, 0xF8, 0xFE, 0x07, 0x03, 0x03,
+	0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07, 0xFF, 0xFF, 0x83, 0x83, 0x83,
+	0xC7, 0xFE, 0x7C, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xF8, 0xFE, 0x07, 0x03, 0x03,
+	0x07, 0xFE, 0xF8, 0x00, 0x07, 0x1F, 0x38, 0x30, 0x36, 0x3C, 0x1F, 0x17, 0x20, 0xFF, 0xFF, 0xC3,
+	0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x38, 0x20, 0x00,
+	0x3C, 0x7E, 0x63, 0xC3, 0xC3, 0x8E, 0x0C, 0x06, 0x1E, 0x38, 0x30, 0x30, 0x31, 0x1F, 0x0F, 0x03,
+	0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30,
+	0x38, 0x1F, 0x0F, 0x07, 0x3F, 0xF8, 0xC0, 0x00, 0xC0, 0xF8, 0x3F, 0x07, 0x00, 0x00, 0x03, 0x1F,
+	0x3C, 0x1F, 0x03, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0x00,
+	0x3F, 0x38, 0x0F, 0x01, 0x01, 0x0F, 0x38, 0x3F, 0x00, 0x01, 0x07, 0x1E, 0x38, 0xF0, 0xE0, 0x38,
+	0x1C, 0x07, 0x01, 0x20, 0x38, 0x1C, 0x0F, 0x07, 0x03, 0x07, 0x1E, 0x38, 0x20, 0x01, 0x07, 0x1E,
+	0x78, 0xE0, 0xE0, 0x78, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0xC3, 0xE3, 0x3B, 0x1F, 0x07, 0x38, 0x3C, 0x37, 0x33, 0x30, 0x30, 0x30,
+	0x30, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x07, 0x7F, 0xF8,
+	0x80, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x38, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x03,
+	0x03, 0x03, 0x03, 0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0x04, 0xC4, 0xE6, 0x33, 0x33, 0x33, 0xB3,
+	0xFF, 0xFE, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0xFF, 0xFF, 0x60, 0x30,
+	0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x18, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xFC, 0xFE, 0x87, 0x03,
+	0x03, 0x87, 0xCE, 0xCC, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0xC0, 0xE0, 0x70, 0x30,
+	0x30, 0x60, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x18, 0x3F, 0x3F, 0xFC, 0xFE, 0xB7, 0x33,
+	0x33, 0x37, 0xBE, 0xB8, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x30, 0x30, 0x30, 0xFE,
+	0xFF, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE,
+	0x87, 0x03, 0x03, 0x86, 0xFF, 0xFF, 0x18, 0x39, 0x33, 0x33, 0x33, 0x39, 0x1F, 0x0F, 0xFF, 0xFF,
+	0x60, 0x30, 0x30, 0x30, 0xF0, 0xE0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30,
+	0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x30, 0x30, 0x30, 0xF3, 0xF3, 0x80, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0x60,
+	0x30, 0x10, 0x00, 0x3F, 0x3F, 0x03, 0x01, 0x03, 0x0E, 0x1C, 0x30, 0x20, 0x03, 0x03, 0x03, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x06, 0x03, 0xFF, 0xFE,
+	0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x06, 0x03, 0x03, 0x03,
+	0xFF, 0xFE, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x87,
+	0xFE, 0xFC, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0x86, 0x03, 0x03, 0x87,
+	0xFE, 0xFC, 0x3F, 0x3F, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x86,
+	0xFF, 0xFF, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x3F, 0x3F, 0x01, 0xFF, 0xFE, 0x06, 0x03, 0x03,
+	0x07, 0x02, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xBE, 0x33, 0x33, 0x33, 0x33,
+	0xF6, 0xE6, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x18, 0x18, 0xFE, 0xFF, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80,
+	0xFF, 0xFF, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x0F, 0x7E, 0xF0, 0x80, 0xF0,
+	0x7E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF,
+	0x07, 0xFF, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x87,
+	0xCE, 0x78, 0x78, 0xCE, 0x87, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x02, 0x03, 0x1F,
+	0xFC, 0xE0, 0x00, 0xF8, 0xFF, 0x07, 0x30, 0x30, 0x38, 0x1F, 0x1F, 0x07, 0x00, 0x00, 0x03, 0x83,
+	0xC3, 0x63, 0x33, 0x1B, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x80, 0xFE, 0xFF, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+	0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00,
+	0xFC, 0xFF, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x06, 0x03, 0x03, 0x03, 0x06, 0x06,
+	0x06, 0x03,
+};
+
+FontPageDef_t Font_11x18_Prop = {
+	12,
+	18,
+	32,
+	126,
+	Font_11x18_Prop_Data,
+	FONTS_FORMAT_PAGE,
+	NULL,
+	NULL,
+	95,
+	Font_11x18_Prop_Glyphs,
+	15
+};
+
+static const FontGlyphDef_t Font_16x26_Prop_Glyphs[] = {
+	{ 0, 8, 0, 0, 0, 0 },
+	{ 0, 6, 0, 0, 5, 21 },
+	{ 15, 12, 0, 0, 11, 7 },
+	{ 26, 17, 0, 0, 16, 21 },
+	{ 74, 14, 0, 0, 13, 23 },
+	{ 113, 17, 0, 0, 16, 21 },
+	{ 161, 17, 0, 0, 16, 21 },
+	{ 209, 6, 0, 0, 5, 7 },
+	{ 214, 13, 0, 0, 12, 25 },
+	{ 262, 13, 0, 0, 12, 25 },
+	{ 310, 15, 0, 0, 14, 12 },
+	{ 338, 17, 0, 6, 16, 15 },
+	{ 370, 6, 0, 17, 5, 9 },
+	{ 380, 14, 0, 11, 13, 2 },
+	{ 393, 6, 0, 17, 5, 4 },
+	{ 398, 17, 0, 0, 16, 25 },
+	{ 462, 16, 0, 0, 15, 21 },
+	{ 507, 15, 0, 0, 14, 21 },
+	{ 549, 14, 0, 0, 13, 21 },
+	{ 588, 13, 0, 0, 12, 21 },
+	{ 624, 17, 0, 0, 16, 21 },
+	{ 672, 13, 0, 0, 12, 21 },
+	{ 708, 16, 0, 0, 15, 21 },
+	{ 753, 15, 0, 0, 14, 21 },
+	{ 795, 16, 0, 0, 15, 21 },
+	{ 840, 16, 0, 0, 15, 21 },
+	{ 885, 6, 0, 6, 5, 15 },
+	{ 895, 6, 0, 6, 5, 20 },
+	{ 910, 17, 0, 6, 16, 15 },
+	{ 942, 17, 0, 10, 16, 7 },
+	{ 958, 17, 0, 6, 16, 15 },
+	{ 990, 15, 0, 0, 14, 21 },
+	{ 1032, 17, 0, 0, 16, 21 },
+	{ 1080, 17, 0, 3, 16, 18 },
+	{ 1128, 15, 0, 3, 14, 18 },
+	{ 1170, 16, 0, 3, 15, 18 },
+	{ 1215, 16, 0, 3, 15, 18 },
+	{ 1260, 15, 0, 3, 14, 18 },
+	{ 1302, 14, 0, 3, 13, 18 },
+	{ 1341, 17, 0, 3, 16, 18 },
+	{ 1389, 16, 0, 3, 15, 18 },
+	{ 1434, 15, 0, 3, 14, 18 },
+	{ 1476, 13, 0, 3, 12, 18 },
+	{ 1512, 15, 0, 3, 14, 18 },
+	{ 1554, 15, 0, 3, 14, 18 },
+	{ 1596, 17, 0, 3, 16, 18 },
+	{ 1644, 16, 0, 3, 15, 18 },
+	{ 1689, 17, 0, 3, 16, 18 },
+	{ 1737, 15, 0, 3, 14, 18 },
+	{ 1779, 17, 0, 3, 16, 22 },
+	{ 1827, 15, 0, 3, 14, 18 },
+	{ 1869, 15, 0, 3, 14, 18 },
+	{ 1911, 17, 0, 3, 16, 18 },
+	{ 1959, 16, 0, 3, 15, 18 },
+	{ 2004, 17, 0, 3, 16, 18 },
+	{ 2052, 17, 0, 3, 16, 18 },
+	{ 2100, 17, 0, 3, 16, 18 },
+	{ 2148, 17, 0, 3, 16, 18 },
+	{ 2196, 16, 0, 3, 15, 18 },
+	{ 2241, 12, 0, 0, 11, 25 },
+	{ 2285, 16, 0, 0, 15, 25 },
+	{ 2345, 12, 0, 0, 11, 25 },
+	{ 2389, 16, 0, 0, 15, 17 },
+	{ 2434, 17, 0, 21, 16, 2 },
+	{ 2450, 5, 0, 0, 4, 1 },
+	{ 2454, 16, 0, 6, 15, 15 },
+	{ 2484, 15, 0, 0, 14, 21 },
+	{ 2526, 16, 0, 6, 15, 15 },
+	{ 2556, 16, 0, 0, 15, 21 },
+	{ 2601, 16, 0, 6, 15, 15 },
+	{ 2631, 16, 0, 0, 15, 21 },
+	{ 2676, 16, 0, 6, 15, 20 },
+	{ 2721, 15, 0, 0, 14, 21 },
+	{ 2763, 12, 0, 0, 11, 21 },
+	{ 2796, 13, 0, 0, 12, 26 },
+	{ 2844, 15, 0, 0, 14, 21 },
+	{ 2886, 12, 0, 0, 11, 21 },
+	{ 2919, 17, 0, 6, 16, 15 },
+	{ 2951, 15, 0, 6, 14, 15 },
+	{ 2979, 16, 0, 6, 15, 15 },
+	{ 3009, 15, 0, 6, 14, 20 },
+	{ 3051, 15, 0, 6, 14, 20 },
+	{ 3093, 14, 0, 6, 13, 15 },
+	{ 3119, 14, 0, 6, 13, 15 },
+	{ 3145, 16, 0, 3, 15, 18 },
+	{ 3190, 14, 0, 6, 13, 15 },
+	{ 3216, 17, 0, 6, 16, 15 },
+	{ 3248, 17, 0, 6, 16, 15 },
+	{ 3280, 16, 0, 6, 15, 15 },
+	{ 3310, 17, 0, 6, 16, 20 },
+	{ 3358, 16, 0, 6, 15, 15 },
+	{ 3388, 14, 0, 0, 13, 25 },
+	{ 3440, 4, 0, 0, 3, 25 },
+	{ 3452, 14, 0, 0, 13, 25 },
+	{ 3504, 17, 0, 11, 16, 5 },
+};
+
+static const uint8_t Font_16x26_Prop_Data[] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x7F, 0x7F, 0x7F, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7F,
+	0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xE0,
+	0xFE, 0xFF, 0xFF, 0xC7, 0xC0, 0xFC, 0xFF, 0xFF, 0xCF, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xFE, 0xFF,
+	0xFF, 0x6F, 0xE0, 0xFC, 0xFF, 0xFF, 0x7F, 0x60, 0x60, 0x60, 0x00, 0x00, 0x1C, 0x1F, 0x1F, 0x0F,
+	0x00, 0x18, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0xFE, 0xFF, 0x87,
+	0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x07, 0x06, 0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFC, 0xF8, 0xF8, 0xF0, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x0F, 0x0F,
+	0x07, 0xFE, 0xFE, 0xFF, 0x03, 0x01, 0xCF, 0xFF, 0xFE, 0xFC, 0x80, 0xE0, 0xF0, 0xFC, 0x3E, 0x1F,
+	0x07, 0x01, 0x01, 0x03, 0x83, 0xC2, 0xF3, 0xFB, 0x7F, 0xFF, 0xFF, 0xFB, 0xF9, 0x18, 0x18, 0xF8,
+	0xF8, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x18, 0x1F,
+	0x1F, 0x00, 0x00, 0x00, 0x38, 0xFE, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFE, 0x7E, 0x00, 0x00,
+	0x00, 0xF8, 0xFC, 0xFC, 0xFE, 0x0F, 0x07, 0x1F, 0x3F, 0xFF, 0xFD, 0xF1, 0xE0, 0x80, 0xF0, 0xFC,
+	0xFC, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x1D, 0x1F, 0x0F, 0x1F, 0x1F, 0x1F,
+	0x1D, 0x3F, 0x7F, 0x7F, 0x7F, 0x1F, 0x00, 0xE0, 0xF0, 0xFC, 0xFC, 0x3E, 0x0F, 0x07, 0x03, 0x03,
+	0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x0F, 0x3F, 0x3F, 0x7C, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3E, 0xFC, 0xFC, 0xF0,
+	0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80,
+	0xC0, 0xC0, 0xE0, 0xF0, 0x7C, 0x3F, 0x3F, 0x0F, 0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x30, 0xF3, 0xFF, 0x1F, 0xBF, 0xF1, 0xB0,
+	0x38, 0x38, 0x38, 0x30, 0x00, 0x04, 0x06, 0x0F, 0x0F, 0x07, 0x01, 0x03, 0x0F, 0x0F, 0x0F, 0x04,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+	0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8,
+	0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03, 0x07, 0x0F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x07, 0x0F,
+	0x1F, 0x1E, 0x1C, 0x18, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E,
+	0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x1F, 0x18, 0x18, 0x18, 0x18, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFE, 0xFE,
+	0xFC, 0x70, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x1E,
+	0x1F, 0x1F, 0x1F, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x06, 0x07, 0x07, 0x03,
+	0x03, 0x03, 0x07, 0xFF, 0xFF, 0xFE, 0xFC, 0x38, 0x00, 0x06, 0x06, 0x06, 0x06, 0x07, 0x0F, 0x1F,
+	0xFF, 0xFD, 0xF8, 0xF0, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x60, 0x78, 0x7C, 0x7F, 0x7F, 0x67, 0x63, 0x60, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x07, 0x0F, 0xBF, 0xFE, 0xFE, 0xFC, 0xF0, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F,
+	0x0F, 0x0F, 0x07, 0x01, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x07,
+	0x07, 0x06, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE,
+	0xFC, 0xF8, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07,
+	0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xF7, 0xFF, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F,
+	0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFE, 0xFF,
+	0xFF, 0x87, 0x03, 0x03, 0x87, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0xC0, 0xF0, 0xF8, 0xFD, 0xFF, 0x1F,
+	0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0xFD, 0xF8, 0xF0, 0xE0, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x1C,
+	0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x07, 0x03, 0x03,
+	0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18,
+	0x1C, 0xEF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x1F,
+	0x0F, 0x07, 0x03, 0x01, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x78, 0x78, 0x78, 0x78, 0x78, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0x0C, 0x0F, 0x0F, 0x07, 0x03, 0x80, 0x80,
+	0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x00, 0x00,
+	0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x03, 0x07,
+	0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x60, 0x70,
+	0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x1E, 0x1F,
+	0x1F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0xFF, 0xFE, 0xFE, 0x7C, 0x18, 0x00, 0x00, 0x00, 0x60,
+	0x78, 0x7C, 0x7E, 0x7F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x1E, 0x8F, 0xC7,
+	0xE3, 0xF3, 0x73, 0x37, 0x7F, 0xFE, 0xFE, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xFF, 0xC1, 0xC0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x1D,
+	0x19, 0x19, 0x19, 0x1D, 0x1C, 0x0D, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0x7F,
+	0x1F, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0x00, 0x00, 0x80, 0xE0, 0xFC, 0xFF, 0x7F, 0x1F, 0x1B, 0x18,
+	0x18, 0x18, 0x1F, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x83,
+	0xC7, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x07, 0x07, 0x9F,
+	0xFE, 0xFC, 0xFC, 0xF8, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
+	0x01, 0x00, 0xE0, 0xF8, 0xFC, 0xFC, 0x3E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07,
+	0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x1F, 0xFE, 0xFE, 0xFC, 0xF8, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xF8,
+	0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x06, 0x07, 0x3F, 0x7F,
+	0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x80, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0xF8,
+	0x7C, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0x1F, 0x7E, 0xFC, 0xF8,
+	0xE0, 0xC0, 0x80, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03,
+	0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF8, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x01, 0x07, 0x3F, 0x3F, 0x3E, 0x3F, 0x1F, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFC, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x01, 0x07, 0x1F, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC0, 0xF8, 0xFC, 0xFE, 0xFE, 0x0F, 0x07,
+	0x03, 0x03, 0x03, 0x07, 0x0F, 0xFE, 0xFE, 0xFC, 0xF8, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03,
+	0x03, 0x03, 0x87, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x07,
+	0x07, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFC, 0xFE, 0xFE, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x0F, 0xFE,
+	0xFE, 0xFC, 0xF8, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF,
+	0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x1F,
+	0x1D, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x07, 0xCF, 0xFF, 0xFE, 0xFE, 0x7C,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x0E, 0x1F, 0x3F, 0x7F, 0xFB, 0xF1, 0xE1, 0xC0, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x7C, 0xFE, 0xFE,
+	0xFF, 0xC7, 0x83, 0x83, 0x83, 0x03, 0x03, 0x07, 0x07, 0x06, 0x00, 0xC0, 0x80, 0x81, 0x81, 0x03,
+	0x03, 0x03, 0x07, 0x87, 0xCF, 0xFF, 0xFE, 0xFE, 0x7C, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80,
+	0xE0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x01, 0x01, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0,
+	0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFF, 0xFE, 0xF0, 0xFC, 0xFF, 0xFF,
+	0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00,
+	0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x07, 0x7F, 0xFF, 0xFF,
+	0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0xFE, 0xFC, 0xF0, 0xE0, 0xE0, 0xF8, 0x7C,
+	0x3E, 0x1F, 0x0F, 0x03, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x7C, 0x3F, 0x1F, 0x0F, 0x3F, 0x7F, 0xFC,
+	0xF8, 0xF0, 0xC0, 0x80, 0x02, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x01, 0x07, 0x1F, 0x3F, 0xFF, 0xFC, 0xF0, 0xE0, 0x80, 0xC0, 0xE0, 0xF8,
+	0xFC, 0x3F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xE3, 0xF3, 0xFB, 0x7F,
+	0x3F, 0x1F, 0x0F, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x7E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0F, 0x3F,
+	0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0x7F, 0xFF, 0xF8, 0xE0,
+	0x80, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3F, 0xFF,
+	0xFC, 0xF0, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x06, 0x86, 0x87, 0xC7, 0xC3, 0xC3, 0xC3, 0xC7, 0xFF,
+	0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x1E, 0x3F, 0x7F, 0x7F, 0x7B, 0x61, 0x60, 0x60, 0x70, 0x3F, 0x3F,
+	0x7F, 0x7F, 0x7F, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80,
+	0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
+	0x1F, 0x1F, 0x1F, 0x0F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0xC0, 0xF8,
+	0xFC, 0xFE, 0xFE, 0x1F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x06, 0x01, 0x0F, 0x1F,
+	0x3F, 0x3F, 0x7C, 0x70, 0x70, 0x60, 0x60, 0x60, 0x60, 0x70, 0x70, 0x30, 0x00, 0x00, 0x80, 0x80,
+	0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1C,
+	0x18, 0x18, 0x1C, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0xCF, 0xC7,
+	0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x78, 0x70, 0x60,
+	0x60, 0x60, 0x60, 0x60, 0x70, 0x70, 0x30, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF,
+	0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFE, 0x3F, 0x07, 0x03, 0x03, 0x07, 0x07, 0xFE, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x07, 0x1F, 0x3F, 0x7F, 0x7E, 0x70, 0x60, 0x60, 0x70, 0x38, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x7F, 0x00, 0x0C, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x0F, 0x0F, 0x07, 0x03,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x1F, 0x1F,
+	0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+	0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFC,
+	0xFE, 0xFF, 0xCF, 0x87, 0x03, 0x01, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x03,
+	0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x0F, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x3E, 0x0F, 0x0F, 0xFF, 0xFF, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+	0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x0F, 0x07, 0x03, 0x03,
+	0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+	0x7F, 0x7F, 0x7F, 0xF0, 0xFC, 0xFE, 0xFE, 0x1F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x1F, 0xFE, 0xFE,
+	0xFC, 0xF8, 0x07, 0x1F, 0x3F, 0x3F, 0x7C, 0x70, 0x60, 0x60, 0x60, 0x70, 0x7C, 0x3F, 0x3F, 0x1F,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFE, 0xF8, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x78, 0x70, 0x60, 0x60, 0x70, 0x7C, 0x7F, 0x3F, 0x1F, 0x07, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFE, 0x1F,
+	0x07, 0x03, 0x03, 0x07, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0x3F, 0x7F, 0x7C, 0x70, 0x60,
+	0x60, 0x70, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x0F, 0x07, 0x03, 0x03, 0x1F,
+	0x1F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+	0x7E, 0x7E, 0xFF, 0xFF, 0xE3, 0xC3, 0xC3, 0xC3, 0x83, 0x87, 0x87, 0x06, 0x30, 0x70, 0x70, 0x70,
+	0x60, 0x60, 0x61, 0x61, 0x73, 0x7F, 0x3F, 0x3F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x1F, 0x3F, 0x7F, 0x7F, 0x70, 0x60, 0x70, 0x78, 0x3C, 0x7F, 0x7F, 0x7F, 0x7F,
+	0x01, 0x07, 0x3F, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0x3F, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0x7F, 0x7C, 0x7F, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00,
+	0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x7E, 0xFE, 0xFE, 0xF0, 0x00, 0xF8, 0xFF, 0xFF,
+	0x00, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x07, 0x00, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x07,
+	0x01, 0x07, 0x0F, 0x1F, 0x7F, 0xFE, 0xF8, 0xF0, 0xF0, 0xFC, 0x7E, 0x1F, 0x0F, 0x03, 0x01, 0x40,
+	0x70, 0x78, 0x7C, 0x3F, 0x1F, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0x7E, 0x78, 0x70, 0x60, 0x01, 0x07,
+	0x1F, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0xFF, 0x1F, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x08, 0x08, 0x0C, 0x0E, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0xF3, 0xFB, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x60, 0x70, 0x7C,
+	0x7E, 0x7F, 0x6F, 0x67, 0x63, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x3E, 0xFF, 0xFF, 0xFF, 0xC3, 0x01, 0x01, 0x01, 0x01, 0x18, 0x18, 0x18, 0x18, 0x3C, 0xFF, 0xFF,
+	0xE7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xC3, 0x80,
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x83, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE7, 0xFF,
+	0xFF, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFF, 0x7C, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x1E, 0x1F, 0x1F, 0x03, 0x03, 0x07, 0x0F, 0x0E, 0x1E, 0x1C, 0x18, 0x18, 0x1F, 0x1F, 0x0F,
+};
+
+FontPageDef_t Font_16x26_Prop = {
+	17,
+	26,
+	32,
+	126,
+	Font_16x26_Prop_Data,
+	FONTS_FORMAT_PAGE,
+	NULL,
+	NULL,
+	95,
+	Font_16x26_Prop_Glyphs,
+	21
+};
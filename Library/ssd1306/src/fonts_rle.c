@@ -0,0 +1,488 @@
+/**
+ ******************************************************************************
+ * @file    fonts_rle.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Generated by Tools/fonttool.py, do not edit.
+ *
+ * Flash usage in bytes:
+ * font           uint16     page   packed      rle     prop
+ * Font_7x10        1900     1330      857     1075     1198
+ * Font_11x18       3420     3135     1580     2084     2122
+ * Font_16x26       4940     6080     3386     3436     4280
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t Font_7x10_Rle_Index[] = {
+	0x0000, 0x0002, 0x0008, 0x0010, 0x0019, 0x0026, 0x002F, 0x0038, 0x003E, 0x004B, 0x0058, 0x0060,
+	0x006A, 0x0074, 0x007A, 0x0080, 0x0088, 0x0091, 0x0098, 0x00A1, 0x00AB, 0x00B4, 0x00BD, 0x00C6,
+	0x00CF, 0x00D8, 0x00E1, 0x00E7, 0x00F1, 0x00FA, 0x0100, 0x010A, 0x0113, 0x011C, 0x0125, 0x012E,
+	0x0137, 0x0141, 0x0148, 0x0151, 0x015B, 0x0164, 0x016C, 0x0175, 0x017E, 0x0185, 0x018E, 0x0197,
+	0x01A0, 0x01A9, 0x01B5, 0x01BF, 0x01C9, 0x01D3, 0x01DC, 0x01E5, 0x01EE, 0x01F7, 0x0200, 0x0209,
+	0x0215, 0x021D, 0x0229, 0x0232, 0x0236, 0x023D, 0x0247, 0x0251, 0x025A, 0x0264, 0x026D, 0x0277,
+	0x0286, 0x0290, 0x0298, 0x02A6, 0x02AF, 0x02B7, 0x02C0, 0x02CA, 0x02D3, 0x02E1, 0x02EE, 0x02F8,
+	0x0302, 0x030A, 0x0314, 0x031D, 0x0326, 0x032F, 0x033E, 0x0347, 0x0354, 0x035E, 0x036B,
+};
+
+static const uint8_t Font_7x10_Rle_Data[] = {
+	0x8C, 0x00, 0x81, 0x00, 0x00, 0xBF, 0x88, 0x00, 0x80, 0x00, 0x02, 0x07, 0x00, 0x07, 0x87, 0x00,
+	0x05, 0x00, 0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x86, 0x00, 0x05, 0x00, 0x66, 0x89, 0xFF, 0x89, 0x72,
+	0x82, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x00, 0x26, 0x19, 0x6E, 0x94, 0x62, 0x86, 0x00, 0x05,
+	0x00, 0x60, 0x96, 0x99, 0x66, 0x90, 0x86, 0x00, 0x81, 0x00, 0x00, 0x07, 0x88, 0x00, 0x80, 0x00,
+	0x02, 0xFC, 0x02, 0x01, 0x83, 0x00, 0x01, 0x01, 0x02, 0x80, 0x00, 0x80, 0x00, 0x02, 0x01, 0x02,
+	0xFC, 0x82, 0x00, 0x01, 0x02, 0x01, 0x81, 0x00, 0x80, 0x00, 0x02, 0x0A, 0x07, 0x0A, 0x87, 0x00,
+	0x00, 0x00, 0x80, 0x10, 0x00, 0x7C, 0x80, 0x10, 0x86, 0x00, 0x81, 0x00, 0x00, 0x80, 0x84, 0x00,
+	0x00, 0x03, 0x81, 0x00, 0x80, 0x00, 0x81, 0x20, 0x87, 0x00, 0x81, 0x00, 0x00, 0x80, 0x88, 0x00,
+	0x80, 0x00, 0x02, 0xC0, 0x3C, 0x03, 0x87, 0x00, 0x05, 0x00, 0x7E, 0x81, 0x89, 0x81, 0x7E, 0x86,
+	0x00, 0x03, 0x00, 0x04, 0x02, 0xFF, 0x88, 0x00, 0x05, 0x00, 0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x86,
+	0x00, 0x02, 0x00, 0x42, 0x81, 0x80, 0x89, 0x00, 0x76, 0x86, 0x00, 0x05, 0x00, 0x30, 0x2C, 0x22,
+	0xFF, 0x20, 0x86, 0x00, 0x01, 0x00, 0x4F, 0x81, 0x89, 0x00, 0x71, 0x86, 0x00, 0x01, 0x00, 0x7E,
+	0x81, 0x89, 0x00, 0x72, 0x86, 0x00, 0x05, 0x00, 0x01, 0xE1, 0x19, 0x05, 0x03, 0x86, 0x00, 0x01,
+	0x00, 0x76, 0x81, 0x89, 0x00, 0x76, 0x86, 0x00, 0x01, 0x00, 0x4E, 0x81, 0x91, 0x00, 0x7E, 0x86,
+	0x00, 0x81, 0x00, 0x00, 0x84, 0x88, 0x00, 0x81, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x03, 0x81,
+	0x00, 0x01, 0x00, 0x10, 0x80, 0x28, 0x80, 0x44, 0x86, 0x00, 0x00, 0x00, 0x83, 0x28, 0x86, 0x00,
+	0x00, 0x00, 0x80, 0x44, 0x80, 0x28, 0x00, 0x10, 0x86, 0x00, 0x05, 0x00, 0x02, 0x01, 0xB1, 0x09,
+	0x06, 0x86, 0x00, 0x05, 0x00, 0x7E, 0x81, 0x99, 0x95, 0x1E, 0x86, 0x00, 0x05, 0x00, 0xE0, 0x3E,
+	0x21, 0x3E, 0xE0, 0x86, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x89, 0x00, 0x76, 0x86, 0x00, 0x01, 0x00,
+	0x7E, 0x81, 0x81, 0x00, 0x42, 0x86, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x81, 0x01, 0x42, 0x3C, 0x86,
+	0x00, 0x01, 0x00, 0xFF, 0x82, 0x89, 0x86, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x09, 0x00, 0x01, 0x86,
+	0x00, 0x02, 0x00, 0x7E, 0x81, 0x80, 0x91, 0x00, 0x72, 0x86, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x08,
+	0x00, 0xFF, 0x86, 0x00, 0x80, 0x00, 0x02, 0x81, 0xFF, 0x81, 0x87, 0x00, 0x01, 0x00, 0x40, 0x81,
+	0x80, 0x00, 0x7F, 0x86, 0x00, 0x05, 0x00, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x86, 0x00, 0x01, 0x00,
+	0xFF, 0x82, 0x80, 0x86, 0x00, 0x05, 0x00, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x86, 0x00, 0x05, 0x00,
+	0xFF, 0x06, 0x18, 0x60, 0xFF, 0x86, 0x00, 0x01, 0x00, 0x7E, 0x81, 0x81, 0x00, 0x7E, 0x86, 0x00,
+	0x01, 0x00, 0xFF, 0x81, 0x11, 0x00, 0x0E, 0x86, 0x00, 0x05, 0x00, 0x7E, 0x81, 0xC1, 0x81, 0x7E,
+	0x84, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x11, 0x01, 0x71, 0x8E, 0x86, 0x00, 0x01,
+	0x00, 0x46, 0x80, 0x89, 0x01, 0x91, 0x62, 0x86, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0xFF, 0x80,
+	0x01, 0x86, 0x00, 0x01, 0x00, 0x7F, 0x81, 0x80, 0x00, 0x7F, 0x86, 0x00, 0x05, 0x00, 0x07, 0x38,
+	0xC0, 0x38, 0x07, 0x86, 0x00, 0x05, 0x00, 0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x86, 0x00, 0x05, 0x00,
+	0x81, 0x66, 0x18, 0x66, 0x81, 0x86, 0x00, 0x05, 0x00, 0x03, 0x0C, 0xF0, 0x0C, 0x03, 0x86, 0x00,
+	0x05, 0x00, 0xC1, 0xA1, 0x99, 0x85, 0x83, 0x86, 0x00, 0x81, 0x00, 0x01, 0xFF, 0x01, 0x83, 0x00,
+	0x01, 0x03, 0x02, 0x80, 0x00, 0x80, 0x00, 0x02, 0x03, 0x3C, 0xC0, 0x87, 0x00, 0x80, 0x00, 0x01,
+	0x01, 0xFF, 0x83, 0x00, 0x01, 0x02, 0x03, 0x81, 0x00, 0x05, 0x00, 0x08, 0x06, 0x01, 0x06, 0x08,
+	0x86, 0x00, 0x85, 0x00, 0x85, 0x02, 0x80, 0x00, 0x01, 0x01, 0x02, 0x88, 0x00, 0x01, 0x00, 0x68,
+	0x80, 0x94, 0x01, 0x54, 0xF8, 0x86, 0x00, 0x02, 0x00, 0xFF, 0x48, 0x80, 0x84, 0x00, 0x78, 0x86,
+	0x00, 0x01, 0x00, 0x78, 0x81, 0x84, 0x00, 0x48, 0x86, 0x00, 0x01, 0x00, 0x78, 0x80, 0x84, 0x01,
+	0x48, 0xFF, 0x86, 0x00, 0x01, 0x00, 0x78, 0x81, 0x94, 0x00, 0x58, 0x86, 0x00, 0x00, 0x00, 0x80,
+	0x04, 0x00, 0xFE, 0x80, 0x05, 0x86, 0x00, 0x01, 0x00, 0x78, 0x80, 0x84, 0x01, 0x48, 0xFC, 0x80,
+	0x00, 0x82, 0x02, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x08, 0x80, 0x04, 0x00, 0xF8, 0x86, 0x00,
+	0x00, 0x00, 0x80, 0x04, 0x00, 0xFD, 0x88, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0xFD, 0x81, 0x00,
+	0x81, 0x02, 0x00, 0x01, 0x81, 0x00, 0x05, 0x00, 0xFF, 0x10, 0x28, 0x44, 0x80, 0x86, 0x00, 0x00,
+	0x00, 0x80, 0x01, 0x00, 0xFF, 0x88, 0x00, 0x05, 0x00, 0xFC, 0x04, 0xFC, 0x04, 0xF8, 0x86, 0x00,
+	0x02, 0x00, 0xFC, 0x08, 0x80, 0x04, 0x00, 0xF8, 0x86, 0x00, 0x01, 0x00, 0x78, 0x81, 0x84, 0x00,
+	0x78, 0x86, 0x00, 0x02, 0x00, 0xFC, 0x48, 0x80, 0x84, 0x00, 0x78, 0x80, 0x00, 0x00, 0x03, 0x83,
+	0x00, 0x01, 0x00, 0x78, 0x80, 0x84, 0x01, 0x48, 0xFC, 0x84, 0x00, 0x01, 0x03, 0x00, 0x02, 0x00,
+	0xFC, 0x08, 0x80, 0x04, 0x00, 0x08, 0x86, 0x00, 0x01, 0x00, 0x48, 0x80, 0x94, 0x01, 0xA4, 0x48,
+	0x86, 0x00, 0x02, 0x00, 0x04, 0x7F, 0x80, 0x84, 0x87, 0x00, 0x01, 0x00, 0x7C, 0x80, 0x80, 0x01,
+	0x40, 0xFC, 0x86, 0x00, 0x05, 0x00, 0x0C, 0x70, 0x80, 0x70, 0x0C, 0x86, 0x00, 0x05, 0x00, 0x3C,
+	0xE0, 0x1C, 0xE0, 0x3C, 0x86, 0x00, 0x05, 0x00, 0x84, 0x48, 0x30, 0x48, 0x84, 0x86, 0x00, 0x05,
+	0x00, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x80, 0x00, 0x80, 0x02, 0x00, 0x01, 0x81, 0x00, 0x05, 0x00,
+	0xC4, 0xA4, 0x94, 0x8C, 0x84, 0x86, 0x00, 0x80, 0x00, 0x02, 0x30, 0xCF, 0x01, 0x83, 0x00, 0x01,
+	0x03, 0x02, 0x80, 0x00, 0x81, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x00, 0x03, 0x81, 0x00, 0x80, 0x00,
+	0x02, 0x01, 0xCF, 0x30, 0x82, 0x00, 0x01, 0x02, 0x03, 0x81, 0x00, 0x01, 0x00, 0x18, 0x80, 0x08,
+	0x01, 0x10, 0x18, 0x86, 0x00,
+};
+
+FontPageDef_t Font_7x10_Rle = {
+	7,
+	10,
+	32,
+	126,
+	Font_7x10_Rle_Data,
+	FONTS_FORMAT_RLE,
+	Font_7x10_Rle_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
+
+static const uint16_t Font_11x18_Rle_Index[] = {
+	0x0000, 0x0002, 0x000C, 0x0016, 0x0030, 0x004B, 0x0064, 0x007D, 0x0083, 0x0099, 0x00AF, 0x00BB,
+	0x00CB, 0x00D7, 0x00DD, 0x00E3, 0x00F1, 0x010A, 0x0118, 0x0130, 0x0148, 0x015D, 0x0175, 0x018E,
+	0x019F, 0x01B5, 0x01CE, 0x01D8, 0x01E8, 0x01FF, 0x0209, 0x021F, 0x0234, 0x024C, 0x0264, 0x0279,
+	0x0290, 0x02A6, 0x02B8, 0x02C8, 0x02E0, 0x02F2, 0x0304, 0x0316, 0x0330, 0x033C, 0x0356, 0x036E,
+	0x0387, 0x039B, 0x03B4, 0x03CC, 0x03E4, 0x03F0, 0x0406, 0x041B, 0x0435, 0x044D, 0x045F, 0x0475,
+	0x0485, 0x0493, 0x04A3, 0x04B8, 0x04BC, 0x04C5, 0x04DD, 0x04F7, 0x0510, 0x0529, 0x0540, 0x0551,
+	0x0572, 0x0587, 0x0593, 0x05AB, 0x05C4, 0x05D0, 0x05E9, 0x05FE, 0x0617, 0x0635, 0x0652, 0x0663,
+	0x0677, 0x0689, 0x069E, 0x06B5, 0x06CB, 0x06E4, 0x0700, 0x0716, 0x072D, 0x073B, 0x0752,
+};
+
+static const uint8_t Font_11x18_Rle_Data[] = {
+	0x9F, 0x00, 0x82, 0x00, 0x80, 0xFE, 0x87, 0x00, 0x80, 0x6F, 0x8E, 0x00, 0x81, 0x00, 0x80, 0x3E,
+	0x00, 0x00, 0x80, 0x3E, 0x97, 0x00, 0x00, 0x00, 0x80, 0x60, 0x80, 0xFE, 0x80, 0x60, 0x80, 0xFE,
+	0x00, 0x60, 0x80, 0x00, 0x00, 0x06, 0x80, 0x7F, 0x80, 0x06, 0x80, 0x7F, 0x80, 0x06, 0x8A, 0x00,
+	0x08, 0x00, 0x38, 0x7C, 0xEE, 0xC6, 0xFE, 0x86, 0x1C, 0x18, 0x81, 0x00, 0x07, 0x1C, 0x3C, 0x70,
+	0x60, 0xFF, 0x61, 0x3F, 0x1E, 0x85, 0x00, 0x00, 0x01, 0x83, 0x00, 0x09, 0x3C, 0x7E, 0x42, 0x7E,
+	0x3C, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x80, 0x00, 0x08, 0x18, 0x0C, 0x06, 0x03, 0x3D, 0x7E, 0x42,
+	0x7E, 0x3C, 0x8A, 0x00, 0x80, 0x00, 0x01, 0x3C, 0x7E, 0x80, 0xC6, 0x01, 0x7E, 0x3C, 0x82, 0x00,
+	0x01, 0x1E, 0x3F, 0x80, 0x61, 0x04, 0x63, 0x36, 0x1C, 0x7F, 0x23, 0x8A, 0x00, 0x82, 0x00, 0x80,
+	0x3E, 0x99, 0x00, 0x82, 0x00, 0x04, 0xC0, 0xF8, 0x1C, 0x06, 0x01, 0x84, 0x00, 0x03, 0x0F, 0x7F,
+	0xE0, 0x80, 0x88, 0x00, 0x01, 0x01, 0x02, 0x80, 0x00, 0x80, 0x00, 0x04, 0x01, 0x06, 0x1C, 0xF8,
+	0xC0, 0x85, 0x00, 0x03, 0x80, 0xE0, 0x7F, 0x0F, 0x84, 0x00, 0x01, 0x02, 0x01, 0x85, 0x00, 0x80,
+	0x00, 0x01, 0x2C, 0x38, 0x80, 0x1E, 0x01, 0x38, 0x2C, 0x97, 0x00, 0x82, 0x80, 0x80, 0xF8, 0x82,
+	0x80, 0x00, 0x00, 0x82, 0x01, 0x80, 0x1F, 0x82, 0x01, 0x8A, 0x00, 0x8D, 0x00, 0x01, 0x60, 0xE0,
+	0x87, 0x00, 0x01, 0x02, 0x01, 0x83, 0x00, 0x8C, 0x00, 0x82, 0x06, 0x8D, 0x00, 0x8D, 0x00, 0x80,
+	0x60, 0x8E, 0x00, 0x83, 0x00, 0x02, 0xF0, 0xFE, 0x0E, 0x84, 0x00, 0x02, 0x70, 0x7F, 0x0F, 0x8E,
+	0x00, 0x03, 0x00, 0xF0, 0xFC, 0x0E, 0x80, 0x86, 0x02, 0x0E, 0xFC, 0xF0, 0x81, 0x00, 0x02, 0x0F,
+	0x3F, 0x70, 0x80, 0x61, 0x02, 0x70, 0x3F, 0x0F, 0x8B, 0x00, 0x80, 0x00, 0x02, 0x30, 0x18, 0x0C,
+	0x80, 0xFE, 0x87, 0x00, 0x80, 0x7F, 0x8D, 0x00, 0x03, 0x00, 0x38, 0x3C, 0x0E, 0x80, 0x06, 0x02,
+	0x8E, 0xFC, 0x78, 0x81, 0x00, 0x05, 0x70, 0x78, 0x6C, 0x66, 0x63, 0x61, 0x80, 0x60, 0x8B, 0x00,
+	0x03, 0x00, 0x18, 0x1C, 0x06, 0x80, 0xC6, 0x01, 0xFC, 0x38, 0x82, 0x00, 0x02, 0x18, 0x38, 0x70,
+	0x80, 0x60, 0x02, 0x71, 0x3F, 0x1E, 0x8B, 0x00, 0x80, 0x00, 0x02, 0x80, 0xF0, 0x3C, 0x80, 0xFE,
+	0x83, 0x00, 0x03, 0x0E, 0x0F, 0x0D, 0x0C, 0x80, 0x7F, 0x80, 0x0C, 0x8B, 0x00, 0x00, 0x00, 0x80,
+	0xFE, 0x00, 0x86, 0x81, 0xC6, 0x00, 0x86, 0x82, 0x00, 0x02, 0x19, 0x39, 0x70, 0x80, 0x60, 0x02,
+	0x71, 0x3F, 0x1F, 0x8B, 0x00, 0x03, 0x00, 0xF0, 0xFC, 0x8E, 0x80, 0xC6, 0x02, 0xCE, 0x9C, 0x18,
+	0x81, 0x00, 0x02, 0x0F, 0x3F, 0x71, 0x80, 0x60, 0x02, 0x71, 0x3F, 0x1F, 0x8B, 0x00, 0x00, 0x00,
+	0x82, 0x06, 0x03, 0xC6, 0xF6, 0x3E, 0x0E, 0x83, 0x00, 0x02, 0x70, 0x7F, 0x07, 0x8E, 0x00, 0x02,
+	0x00, 0x38, 0x7C, 0x81, 0x86, 0x02, 0x8E, 0x7C, 0x38, 0x81, 0x00, 0x01, 0x1E, 0x3F, 0x82, 0x61,
+	0x01, 0x3F, 0x1E, 0x8B, 0x00, 0x03, 0x00, 0xF8, 0xFC, 0x8E, 0x80, 0x06, 0x02, 0x8E, 0xFC, 0xF0,
+	0x81, 0x00, 0x02, 0x18, 0x39, 0x73, 0x80, 0x63, 0x02, 0x71, 0x3F, 0x0F, 0x8B, 0x00, 0x82, 0x00,
+	0x80, 0x60, 0x87, 0x00, 0x80, 0x60, 0x8E, 0x00, 0x82, 0x00, 0x80, 0xC0, 0x87, 0x00, 0x01, 0x60,
+	0xE0, 0x87, 0x00, 0x01, 0x02, 0x01, 0x83, 0x00, 0x80, 0x00, 0x80, 0x80, 0x04, 0xC0, 0x40, 0x60,
+	0x20, 0x30, 0x81, 0x00, 0x07, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x8B, 0x00, 0x00,
+	0x00, 0x86, 0x60, 0x81, 0x00, 0x86, 0x06, 0x8B, 0x00, 0x05, 0x00, 0x30, 0x20, 0x60, 0x40, 0xC0,
+	0x80, 0x80, 0x82, 0x00, 0x07, 0x18, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, 0x8B, 0x00, 0x03,
+	0x00, 0x18, 0x1C, 0x0E, 0x80, 0x06, 0x03, 0x86, 0xCE, 0xFC, 0x78, 0x83, 0x00, 0x03, 0x6E, 0x6F,
+	0x03, 0x01, 0x8C, 0x00, 0x03, 0x00, 0xF0, 0xFC, 0x1E, 0x80, 0xC6, 0x02, 0x66, 0xFC, 0xF8, 0x81,
+	0x00, 0x05, 0x0F, 0x3F, 0x70, 0x63, 0x67, 0x36, 0x80, 0x07, 0x8B, 0x00, 0x80, 0x00, 0x06, 0x80,
+	0xF8, 0x7E, 0x06, 0x7E, 0xF8, 0x80, 0x81, 0x00, 0x02, 0x70, 0x7F, 0x0F, 0x81, 0x06, 0x02, 0x0F,
+	0x7F, 0x70, 0x8A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x81, 0x86, 0x01, 0xFC, 0x78, 0x82, 0x00, 0x80,
+	0x7F, 0x81, 0x61, 0x02, 0x73, 0x3E, 0x1C, 0x8B, 0x00, 0x03, 0x00, 0xF0, 0xFC, 0x0E, 0x81, 0x06,
+	0x01, 0x1C, 0x18, 0x81, 0x00, 0x02, 0x0F, 0x3F, 0x70, 0x81, 0x60, 0x01, 0x38, 0x18, 0x8B, 0x00,
+	0x00, 0x00, 0x80, 0xFE, 0x81, 0x06, 0x02, 0x1C, 0xFC, 0xF0, 0x81, 0x00, 0x80, 0x7F, 0x81, 0x60,
+	0x02, 0x38, 0x1F, 0x07, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x83, 0x86, 0x00, 0x06, 0x81, 0x00,
+	0x80, 0x7F, 0x83, 0x61, 0x00, 0x60, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x83, 0x86, 0x00, 0x06,
+	0x81, 0x00, 0x80, 0x7F, 0x83, 0x01, 0x8C, 0x00, 0x03, 0x00, 0xF0, 0xFC, 0x0E, 0x81, 0x06, 0x01,
+	0x1C, 0x18, 0x81, 0x00, 0x02, 0x0F, 0x3F, 0x70, 0x80, 0x60, 0x00, 0x63, 0x80, 0x3F, 0x8B, 0x00,
+	0x00, 0x00, 0x80, 0xFE, 0x82, 0x80, 0x80, 0xFE, 0x81, 0x00, 0x80, 0x7F, 0x82, 0x01, 0x80, 0x7F,
+	0x8B, 0x00, 0x80, 0x00, 0x80, 0x06, 0x80, 0xFE, 0x80, 0x06, 0x83, 0x00, 0x80, 0x60, 0x80, 0x7F,
+	0x80, 0x60, 0x8C, 0x00, 0x85, 0x00, 0x80, 0xFE, 0x81, 0x00, 0x02, 0x1C, 0x3C, 0x70, 0x80, 0x60,
+	0x02, 0x70, 0x3F, 0x1F, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x06, 0x80, 0xC0, 0x70, 0x38, 0x0C,
+	0x06, 0x02, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x01, 0x04, 0x07, 0x0E, 0x38, 0x70, 0x40, 0x8A, 0x00,
+	0x00, 0x00, 0x80, 0xFE, 0x87, 0x00, 0x80, 0x7F, 0x84, 0x60, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xFE,
+	0x04, 0x1E, 0xF8, 0x80, 0xF8, 0x0E, 0x80, 0xFE, 0x80, 0x00, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x80, 0x7F, 0x8A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x03, 0x3E, 0xF8, 0xC0, 0x00, 0x80,
+	0xFE, 0x81, 0x00, 0x80, 0x7F, 0x03, 0x00, 0x01, 0x1F, 0x7C, 0x80, 0x7F, 0x8B, 0x00, 0x03, 0x00,
+	0xF0, 0xFC, 0x0E, 0x80, 0x06, 0x02, 0x0E, 0xFC, 0xF0, 0x81, 0x00, 0x02, 0x0F, 0x3F, 0x70, 0x80,
+	0x60, 0x02, 0x70, 0x3F, 0x0F, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x81, 0x06, 0x02, 0x8E, 0xFC,
+	0xF8, 0x81, 0x00, 0x80, 0x7F, 0x82, 0x03, 0x00, 0x01, 0x8C, 0x00, 0x03, 0x00, 0xF0, 0xFC, 0x0E,
+	0x80, 0x06, 0x02, 0x0E, 0xFC, 0xF0, 0x81, 0x00, 0x08, 0x0F, 0x3F, 0x70, 0x60, 0x6C, 0x78, 0x3F,
+	0x2F, 0x40, 0x8A, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x81, 0x86, 0x02, 0xCE, 0xFC, 0x78, 0x81, 0x00,
+	0x80, 0x7F, 0x80, 0x01, 0x04, 0x03, 0x0F, 0x3C, 0x70, 0x40, 0x8A, 0x00, 0x80, 0x00, 0x02, 0x78,
+	0xFC, 0xC6, 0x80, 0x86, 0x01, 0x1C, 0x18, 0x81, 0x00, 0x07, 0x0C, 0x3C, 0x70, 0x60, 0x61, 0x63,
+	0x3F, 0x1E, 0x8B, 0x00, 0x82, 0x06, 0x80, 0xFE, 0x82, 0x06, 0x83, 0x00, 0x80, 0x7F, 0x8E, 0x00,
+	0x00, 0x00, 0x80, 0xFE, 0x82, 0x00, 0x80, 0xFE, 0x81, 0x00, 0x02, 0x1F, 0x3F, 0x70, 0x80, 0x60,
+	0x02, 0x70, 0x3F, 0x1F, 0x8B, 0x00, 0x09, 0x00, 0x0E, 0x7E, 0xF0, 0x80, 0x00, 0x80, 0xF0, 0x7E,
+	0x0E, 0x82, 0x00, 0x04, 0x07, 0x3F, 0x78, 0x3F, 0x07, 0x8C, 0x00, 0x01, 0x7E, 0xFE, 0x80, 0x00,
+	0x80, 0xC0, 0x80, 0x00, 0x01, 0xFE, 0x7E, 0x80, 0x00, 0x02, 0x7F, 0x70, 0x1E, 0x80, 0x03, 0x02,
+	0x1E, 0x70, 0x7F, 0x8B, 0x00, 0x14, 0x02, 0x0E, 0x3C, 0x70, 0xE0, 0xC0, 0x70, 0x38, 0x0E, 0x02,
+	0x00, 0x40, 0x70, 0x38, 0x1E, 0x0F, 0x07, 0x0E, 0x3C, 0x70, 0x40, 0x8A, 0x00, 0x03, 0x02, 0x0E,
+	0x3C, 0xF0, 0x80, 0xC0, 0x03, 0xF0, 0x3C, 0x0E, 0x02, 0x83, 0x00, 0x80, 0x7F, 0x8E, 0x00, 0x80,
+	0x00, 0x80, 0x06, 0x04, 0x86, 0xC6, 0x76, 0x3E, 0x0E, 0x81, 0x00, 0x04, 0x70, 0x78, 0x6E, 0x67,
+	0x61, 0x81, 0x60, 0x8B, 0x00, 0x82, 0x00, 0x80, 0xFF, 0x80, 0x03, 0x85, 0x00, 0x80, 0xFF, 0x87,
+	0x00, 0x82, 0x03, 0x81, 0x00, 0x81, 0x00, 0x02, 0x0E, 0xFE, 0xF0, 0x88, 0x00, 0x02, 0x0F, 0x7F,
+	0x70, 0x8C, 0x00, 0x81, 0x00, 0x80, 0x03, 0x80, 0xFF, 0x87, 0x00, 0x80, 0xFF, 0x85, 0x00, 0x82,
+	0x03, 0x82, 0x00, 0x03, 0x00, 0x80, 0xE0, 0x78, 0x80, 0x0E, 0x02, 0x78, 0xE0, 0x80, 0x81, 0x00,
+	0x80, 0x01, 0x82, 0x00, 0x80, 0x01, 0x8B, 0x00, 0x94, 0x00, 0x89, 0x01, 0x80, 0x00, 0x03, 0x02,
+	0x06, 0x0E, 0x08, 0x99, 0x00, 0x02, 0x00, 0x80, 0xC0, 0x82, 0x60, 0x01, 0xE0, 0xC0, 0x81, 0x00,
+	0x01, 0x38, 0x7C, 0x80, 0x66, 0x04, 0x26, 0x36, 0x3F, 0x7F, 0x40, 0x8A, 0x00, 0x00, 0x00, 0x80,
+	0xFE, 0x00, 0xC0, 0x80, 0x60, 0x02, 0xE0, 0xC0, 0x80, 0x81, 0x00, 0x80, 0x7F, 0x00, 0x30, 0x80,
+	0x60, 0x02, 0x70, 0x3F, 0x1F, 0x8B, 0x00, 0x03, 0x00, 0x80, 0xC0, 0xE0, 0x80, 0x60, 0x02, 0xE0,
+	0xC0, 0x80, 0x81, 0x00, 0x02, 0x1F, 0x3F, 0x70, 0x80, 0x60, 0x02, 0x70, 0x39, 0x19, 0x8B, 0x00,
+	0x03, 0x00, 0x80, 0xC0, 0xE0, 0x80, 0x60, 0x00, 0xC0, 0x80, 0xFE, 0x81, 0x00, 0x02, 0x1F, 0x3F,
+	0x70, 0x80, 0x60, 0x00, 0x30, 0x80, 0x7F, 0x8B, 0x00, 0x03, 0x00, 0x80, 0xC0, 0xE0, 0x80, 0x60,
+	0x01, 0xE0, 0xC0, 0x82, 0x00, 0x02, 0x1F, 0x3F, 0x76, 0x81, 0x66, 0x01, 0x37, 0x17, 0x8B, 0x00,
+	0x00, 0x00, 0x81, 0x60, 0x01, 0xFC, 0xFE, 0x81, 0x66, 0x00, 0x06, 0x83, 0x00, 0x80, 0x7F, 0x8E,
+	0x00, 0x03, 0x00, 0xC0, 0xE0, 0x70, 0x80, 0x30, 0x00, 0x60, 0x80, 0xF0, 0x81, 0x00, 0x02, 0x8F,
+	0x9F, 0x38, 0x80, 0x30, 0x00, 0x98, 0x80, 0xFF, 0x81, 0x00, 0x00, 0x01, 0x83, 0x03, 0x00, 0x01,
+	0x81, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x00, 0xC0, 0x81, 0x60, 0x01, 0xE0, 0xC0, 0x81, 0x00, 0x80,
+	0x7F, 0x82, 0x00, 0x80, 0x7F, 0x8B, 0x00, 0x80, 0x00, 0x81, 0x60, 0x80, 0xE6, 0x87, 0x00, 0x80,
+	0x7F, 0x8D, 0x00, 0x80, 0x00, 0x81, 0x30, 0x80, 0xF3, 0x83, 0x00, 0x00, 0x80, 0x81, 0x00, 0x80,
+	0xFF, 0x83, 0x00, 0x00, 0x01, 0x82, 0x03, 0x00, 0x01, 0x82, 0x00, 0x00, 0x00, 0x80, 0xFE, 0x80,
+	0x00, 0x03, 0x80, 0xC0, 0x60, 0x20, 0x81, 0x00, 0x80, 0x7F, 0x06, 0x06, 0x03, 0x07, 0x1C, 0x38,
+	0x60, 0x40, 0x8A, 0x00, 0x80, 0x00, 0x81, 0x06, 0x80, 0xFE, 0x87, 0x00, 0x80, 0x7F, 0x8D, 0x00,
+	0x80, 0xE0, 0x01, 0x40, 0x60, 0x80, 0xE0, 0x04, 0xC0, 0x60, 0xE0, 0xC0, 0x00, 0x80, 0x7F, 0x80,
+	0x00, 0x80, 0x7F, 0x80, 0x00, 0x80, 0x7F, 0x8A, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x00, 0xC0, 0x81,
+	0x60, 0x01, 0xE0, 0xC0, 0x81, 0x00, 0x80, 0x7F, 0x82, 0x00, 0x80, 0x7F, 0x8B, 0x00, 0x03, 0x00,
+	0x80, 0xC0, 0xE0, 0x80, 0x60, 0x02, 0xE0, 0xC0, 0x80, 0x81, 0x00, 0x02, 0x1F, 0x3F, 0x70, 0x80,
+	0x60, 0x02, 0x70, 0x3F, 0x1F, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x00, 0x60, 0x80, 0x30, 0x02,
+	0x70, 0xE0, 0xC0, 0x81, 0x00, 0x80, 0xFF, 0x00, 0x18, 0x80, 0x30, 0x02, 0x38, 0x1F, 0x0F, 0x81,
+	0x00, 0x80, 0x03, 0x86, 0x00, 0x03, 0x00, 0xC0, 0xE0, 0x70, 0x80, 0x30, 0x00, 0x60, 0x80, 0xF0,
+	0x81, 0x00, 0x02, 0x0F, 0x1F, 0x38, 0x80, 0x30, 0x00, 0x18, 0x80, 0xFF, 0x87, 0x00, 0x80, 0x03,
+	0x80, 0x00, 0x02, 0x00, 0x20, 0xE0, 0x80, 0xC0, 0x80, 0x60, 0x01, 0xE0, 0x40, 0x82, 0x00, 0x80,
+	0x7F, 0x90, 0x00, 0x02, 0x00, 0x80, 0xC0, 0x82, 0x60, 0x80, 0xC0, 0x81, 0x00, 0x01, 0x33, 0x37,
+	0x82, 0x66, 0x01, 0x3E, 0x1C, 0x8B, 0x00, 0x00, 0x00, 0x80, 0x60, 0x01, 0xF8, 0xFC, 0x81, 0x60,
+	0x84, 0x00, 0x01, 0x3F, 0x7F, 0x82, 0x60, 0x8B, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x82, 0x00, 0x80,
+	0xE0, 0x81, 0x00, 0x01, 0x3F, 0x7F, 0x81, 0x60, 0x00, 0x30, 0x80, 0x7F, 0x8B, 0x00, 0x03, 0x00,
+	0x20, 0xE0, 0xC0, 0x81, 0x00, 0x02, 0xC0, 0xE0, 0x20, 0x81, 0x00, 0x06, 0x01, 0x0F, 0x3E, 0x70,
+	0x7E, 0x0F, 0x01, 0x8B, 0x00, 0x80, 0xE0, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x81,
+	0x00, 0x06, 0x1F, 0x78, 0x1F, 0x00, 0x1F, 0x78, 0x1F, 0x8C, 0x00, 0x03, 0x00, 0x20, 0xE0, 0xC0,
+	0x80, 0x00, 0x02, 0xC0, 0xE0, 0x20, 0x81, 0x00, 0x02, 0x40, 0x70, 0x39, 0x80, 0x0F, 0x02, 0x39,
+	0x70, 0x40, 0x8B, 0x00, 0x03, 0x00, 0x30, 0xF0, 0xC0, 0x80, 0x00, 0x02, 0x80, 0xF0, 0x70, 0x82,
+	0x00, 0x05, 0x01, 0x8F, 0xFE, 0xF0, 0x7F, 0x0F, 0x82, 0x00, 0x81, 0x03, 0x80, 0x01, 0x83, 0x00,
+	0x00, 0x00, 0x84, 0x60, 0x80, 0xE0, 0x00, 0x60, 0x80, 0x00, 0x06, 0x60, 0x70, 0x78, 0x6C, 0x66,
+	0x63, 0x61, 0x80, 0x60, 0x8A, 0x00, 0x82, 0x00, 0x02, 0x80, 0xFE, 0xFF, 0x80, 0x03, 0x83, 0x00,
+	0x03, 0x03, 0x07, 0xFF, 0xFC, 0x87, 0x00, 0x00, 0x01, 0x81, 0x03, 0x80, 0x00, 0x83, 0x00, 0x80,
+	0xFF, 0x87, 0x00, 0x80, 0xFF, 0x87, 0x00, 0x80, 0x03, 0x82, 0x00, 0x80, 0x00, 0x80, 0x03, 0x02,
+	0xFF, 0xFE, 0x80, 0x86, 0x00, 0x03, 0xFC, 0xFF, 0x07, 0x03, 0x83, 0x00, 0x81, 0x03, 0x00, 0x01,
+	0x83, 0x00, 0x80, 0x00, 0x81, 0x80, 0x81, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x03, 0x81, 0x01,
+	0x81, 0x03, 0x00, 0x01, 0x8B, 0x00,
+};
+
+FontPageDef_t Font_11x18_Rle = {
+	11,
+	18,
+	32,
+	126,
+	Font_11x18_Rle_Data,
+	FONTS_FORMAT_RLE,
+	Font_11x18_Rle_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
+
+static const uint16_t Font_16x26_Rle_Index[] = {
+	0x0000, 0x0002, 0x0012, 0x001C, 0x0050, 0x0081, 0x00B8, 0x00ED, 0x00F7, 0x011F, 0x0149, 0x016A,
+	0x017C, 0x018C, 0x0192, 0x0198, 0x01BC, 0x01EA, 0x0202, 0x022B, 0x0257, 0x0278, 0x029B, 0x02D3,
+	0x02F3, 0x032E, 0x0363, 0x0371, 0x0387, 0x03AC, 0x03B4, 0x03D7, 0x03F8, 0x042C, 0x0454, 0x047E,
+	0x04A4, 0x04CA, 0x04DE, 0x04F0, 0x051F, 0x0539, 0x054F, 0x0568, 0x0592, 0x05A2, 0x05C7, 0x05ED,
+	0x061C, 0x063B, 0x066C, 0x069A, 0x06CF, 0x06DF, 0x0703, 0x072C, 0x0759, 0x0792, 0x07B8, 0x07DD,
+	0x07F1, 0x0812, 0x0828, 0x084E, 0x0854, 0x085A, 0x0889, 0x08B7, 0x08DF, 0x0907, 0x0933, 0x094C,
+	0x0982, 0x09A4, 0x09B6, 0x09D2, 0x09FD, 0x0A0D, 0x0A33, 0x0A55, 0x0A83, 0x0AB4, 0x0AE4, 0x0AFE,
+	0x0B2A, 0x0B43, 0x0B64, 0x0B8C, 0x0BB7, 0x0BEC, 0x0C1C, 0x0C3B, 0x0C60, 0x0C72, 0x0C97,
+};
+
+static const uint8_t Font_16x26_Rle_Data[] = {
+	0xBE, 0x00, 0x84, 0x00, 0x83, 0xFF, 0x89, 0x00, 0x00, 0x03, 0x81, 0x7F, 0x8A, 0x00, 0x83, 0x1C,
+	0x93, 0x00, 0x81, 0x00, 0x82, 0x7F, 0x81, 0x00, 0x82, 0x7F, 0xB0, 0x00, 0x01, 0x00, 0x80, 0x81,
+	0xC0, 0x01, 0xE0, 0xFE, 0x80, 0xFF, 0x02, 0xC7, 0xC0, 0xFC, 0x80, 0xFF, 0x01, 0xCF, 0xC0, 0x81,
+	0x60, 0x01, 0xE0, 0xFE, 0x80, 0xFF, 0x02, 0x6F, 0xE0, 0xFC, 0x80, 0xFF, 0x00, 0x7F, 0x81, 0x60,
+	0x80, 0x00, 0x00, 0x1C, 0x80, 0x1F, 0x02, 0x0F, 0x00, 0x18, 0x81, 0x1F, 0x00, 0x01, 0x92, 0x00,
+	0x81, 0x00, 0x00, 0xFC, 0x80, 0xFE, 0x01, 0xFF, 0x87, 0x81, 0xFF, 0x00, 0x03, 0x80, 0x07, 0x00,
+	0x06, 0x83, 0x00, 0x02, 0x01, 0x03, 0x07, 0x82, 0xFF, 0x00, 0xFC, 0x80, 0xF8, 0x00, 0xF0, 0x81,
+	0x00, 0x80, 0x0C, 0x80, 0x1C, 0x00, 0x18, 0x82, 0x7F, 0x00, 0x1F, 0x80, 0x0F, 0x00, 0x07, 0x8F,
+	0x00, 0x80, 0xFE, 0x0D, 0xFF, 0x03, 0x01, 0xCF, 0xFF, 0xFE, 0xFC, 0x80, 0xE0, 0xF0, 0xFC, 0x3E,
+	0x1F, 0x07, 0x80, 0x01, 0x05, 0x03, 0x83, 0xC2, 0xF3, 0xFB, 0x7F, 0x80, 0xFF, 0x01, 0xFB, 0xF9,
+	0x80, 0x18, 0x80, 0xF8, 0x05, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x01, 0x80, 0x00, 0x01, 0x07, 0x0F,
+	0x80, 0x1F, 0x80, 0x18, 0x80, 0x1F, 0x8E, 0x00, 0x81, 0x00, 0x01, 0x38, 0xFE, 0x81, 0xFF, 0x00,
+	0x83, 0x80, 0xFF, 0x01, 0xFE, 0x7E, 0x81, 0x00, 0x00, 0xF8, 0x80, 0xFC, 0x0A, 0xFE, 0x0F, 0x07,
+	0x1F, 0x3F, 0xFF, 0xFD, 0xF1, 0xE0, 0x80, 0xF0, 0x80, 0xFC, 0x05, 0x03, 0x07, 0x0F, 0x1F, 0x1E,
+	0x1C, 0x81, 0x18, 0x02, 0x1D, 0x1F, 0x0F, 0x81, 0x1F, 0x00, 0x1D, 0x8E, 0x00, 0x84, 0x00, 0x00,
+	0x3F, 0x81, 0x7F, 0x00, 0x1F, 0xB3, 0x00, 0x83, 0x00, 0x01, 0xE0, 0xF0, 0x80, 0xFC, 0x02, 0x3E,
+	0x0F, 0x07, 0x80, 0x03, 0x80, 0x01, 0x82, 0x00, 0x82, 0xFF, 0x00, 0x81, 0x8A, 0x00, 0x01, 0x07,
+	0x0F, 0x80, 0x3F, 0x02, 0x7C, 0xF0, 0xE0, 0x80, 0xC0, 0x80, 0x80, 0x8A, 0x00, 0x82, 0x01, 0x00,
+	0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x07, 0x0F, 0x3E, 0x80, 0xFC, 0x01, 0xF0, 0xE0, 0x8A, 0x00,
+	0x00, 0x81, 0x82, 0xFF, 0x82, 0x00, 0x80, 0x80, 0x80, 0xC0, 0x02, 0xE0, 0xF0, 0x7C, 0x80, 0x3F,
+	0x01, 0x0F, 0x07, 0x83, 0x00, 0x82, 0x01, 0x89, 0x00, 0x80, 0x00, 0x81, 0x38, 0x06, 0x30, 0xF3,
+	0xFF, 0x1F, 0xBF, 0xF1, 0xB0, 0x81, 0x38, 0x00, 0x30, 0x81, 0x00, 0x01, 0x04, 0x06, 0x80, 0x0F,
+	0x02, 0x07, 0x01, 0x03, 0x81, 0x0F, 0x00, 0x04, 0xA0, 0x00, 0x85, 0x00, 0x81, 0xC0, 0x84, 0x00,
+	0x85, 0x60, 0x81, 0xFF, 0x84, 0x60, 0x85, 0x00, 0x81, 0x1F, 0x94, 0x00, 0xA4, 0x00, 0x00, 0x1E,
+	0x82, 0xFE, 0x89, 0x00, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x84, 0x00, 0x90, 0x00, 0x8B, 0x18,
+	0x9F, 0x00, 0xA4, 0x00, 0x83, 0x1E, 0x93, 0x00, 0x87, 0x00, 0x06, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F,
+	0x0F, 0x03, 0x83, 0x00, 0x06, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x83, 0x00, 0x06, 0xC0,
+	0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x86, 0x00, 0x82, 0x01, 0x8A, 0x00, 0x10, 0x00, 0xE0, 0xF8,
+	0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03, 0x07, 0x0F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x82, 0xFF,
+	0x00, 0xC0, 0x83, 0x00, 0x00, 0xC0, 0x82, 0xFF, 0x80, 0x00, 0x0C, 0x03, 0x07, 0x0F, 0x1F, 0x1E,
+	0x1C, 0x18, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x8F, 0x00, 0x80, 0x00, 0x81, 0x0C, 0x80, 0x0E,
+	0x00, 0xFE, 0x82, 0xFF, 0x89, 0x00, 0x83, 0xFF, 0x84, 0x00, 0x83, 0x18, 0x83, 0x1F, 0x82, 0x18,
+	0x8E, 0x00, 0x80, 0x00, 0x80, 0x06, 0x80, 0x07, 0x81, 0x03, 0x01, 0x07, 0xFF, 0x80, 0xFE, 0x01,
+	0xFC, 0x70, 0x83, 0x00, 0x09, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x82,
+	0x00, 0x00, 0x1E, 0x81, 0x1F, 0x00, 0x1B, 0x86, 0x18, 0x8F, 0x00, 0x81, 0x00, 0x00, 0x06, 0x80,
+	0x07, 0x81, 0x03, 0x00, 0x07, 0x80, 0xFF, 0x02, 0xFE, 0xFC, 0x38, 0x83, 0x00, 0x82, 0x06, 0x06,
+	0x07, 0x0F, 0x1F, 0xFF, 0xFD, 0xF8, 0xF0, 0x82, 0x00, 0x81, 0x1C, 0x81, 0x18, 0x01, 0x1C, 0x1E,
+	0x80, 0x0F, 0x01, 0x07, 0x03, 0x8F, 0x00, 0x82, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xF8, 0x7E, 0x82,
+	0xFF, 0x81, 0x00, 0x02, 0x60, 0x78, 0x7C, 0x80, 0x7F, 0x01, 0x67, 0x63, 0x80, 0x60, 0x82, 0xFF,
+	0x81, 0x60, 0x87, 0x00, 0x82, 0x1F, 0x91, 0x00, 0x81, 0x00, 0x82, 0xFF, 0x85, 0x07, 0x83, 0x00,
+	0x83, 0x03, 0x02, 0x07, 0x0F, 0xBF, 0x80, 0xFE, 0x01, 0xFC, 0xF0, 0x82, 0x00, 0x81, 0x1C, 0x81,
+	0x18, 0x01, 0x1C, 0x1F, 0x80, 0x0F, 0x01, 0x07, 0x01, 0x8F, 0x00, 0x80, 0x00, 0x06, 0xE0, 0xF8,
+	0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x81, 0x03, 0x80, 0x07, 0x00, 0x06, 0x80, 0x00, 0x00, 0x0C, 0x82,
+	0xFF, 0x01, 0x0E, 0x07, 0x80, 0x03, 0x05, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0x80, 0x00, 0x01,
+	0x01, 0x07, 0x80, 0x0F, 0x01, 0x1F, 0x1C, 0x80, 0x18, 0x01, 0x1C, 0x1E, 0x80, 0x0F, 0x01, 0x07,
+	0x03, 0x8E, 0x00, 0x80, 0x00, 0x86, 0x07, 0x05, 0xC7, 0xF7, 0xFF, 0x7F, 0x3F, 0x0F, 0x83, 0x00,
+	0x07, 0x80, 0xE0, 0xF8, 0xFE, 0x7F, 0x1F, 0x07, 0x01, 0x84, 0x00, 0x00, 0x18, 0x82, 0x1F, 0x00,
+	0x03, 0x95, 0x00, 0x80, 0x00, 0x02, 0x30, 0xFC, 0xFE, 0x80, 0xFF, 0x00, 0x87, 0x80, 0x03, 0x00,
+	0x87, 0x80, 0xFF, 0x01, 0xFE, 0x7C, 0x80, 0x00, 0x06, 0xC0, 0xF0, 0xF8, 0xFD, 0xFF, 0x1F, 0x07,
+	0x80, 0x0F, 0x08, 0x1F, 0x7F, 0xFD, 0xF8, 0xF0, 0xE0, 0x00, 0x01, 0x07, 0x80, 0x0F, 0x00, 0x1F,
+	0x80, 0x1C, 0x80, 0x18, 0x01, 0x1C, 0x1E, 0x80, 0x0F, 0x01, 0x07, 0x03, 0x8E, 0x00, 0x06, 0x00,
+	0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x07, 0x80, 0x03, 0x09, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0,
+	0x00, 0x01, 0x07, 0x80, 0x0F, 0x01, 0x1F, 0x1C, 0x81, 0x18, 0x01, 0x1C, 0xEF, 0x81, 0xFF, 0x00,
+	0x3F, 0x80, 0x00, 0x00, 0x0C, 0x80, 0x1C, 0x81, 0x18, 0x80, 0x1C, 0x04, 0x1F, 0x0F, 0x07, 0x03,
+	0x01, 0x8F, 0x00, 0x84, 0x00, 0x83, 0xC0, 0x89, 0x00, 0x83, 0x03, 0x89, 0x00, 0x83, 0x1E, 0x93,
+	0x00, 0x84, 0x00, 0x83, 0xC0, 0x89, 0x00, 0x83, 0x03, 0x89, 0x00, 0x00, 0x1E, 0x82, 0xFE, 0x89,
+	0x00, 0x81, 0x03, 0x00, 0x01, 0x84, 0x00, 0x8A, 0x00, 0x80, 0x80, 0x80, 0xC0, 0x80, 0x20, 0x80,
+	0x70, 0x80, 0xF8, 0x01, 0xFC, 0xDC, 0x80, 0x8E, 0x80, 0x07, 0x80, 0x03, 0x80, 0x01, 0x84, 0x00,
+	0x80, 0x01, 0x80, 0x03, 0x80, 0x07, 0x80, 0x0E, 0x80, 0x1C, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x8C,
+	0x8E, 0x01, 0x8E, 0x00, 0x81, 0xC0, 0x80, 0x80, 0x8A, 0x00, 0x80, 0x01, 0x80, 0x03, 0x80, 0x07,
+	0x80, 0x8E, 0x80, 0xDC, 0x80, 0xF8, 0x80, 0x70, 0x01, 0x20, 0x18, 0x80, 0x1C, 0x80, 0x0E, 0x80,
+	0x07, 0x80, 0x03, 0x80, 0x01, 0x93, 0x00, 0x80, 0x00, 0x00, 0x1E, 0x80, 0x1F, 0x83, 0x03, 0x01,
+	0x87, 0xFF, 0x80, 0xFE, 0x01, 0x7C, 0x18, 0x83, 0x00, 0x07, 0x60, 0x78, 0x7C, 0x7E, 0x7F, 0x07,
+	0x03, 0x01, 0x86, 0x00, 0x83, 0x1C, 0x94, 0x00, 0x0C, 0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x1E, 0x8F,
+	0xC7, 0xE3, 0xF3, 0x73, 0x37, 0x7F, 0x80, 0xFE, 0x01, 0xF8, 0x3F, 0x81, 0xFF, 0x01, 0x80, 0x00,
+	0x81, 0xFF, 0x03, 0xC1, 0xC0, 0xF0, 0xFE, 0x81, 0xFF, 0x07, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E,
+	0x1C, 0x1D, 0x81, 0x19, 0x02, 0x1D, 0x1C, 0x0D, 0x80, 0x01, 0x8E, 0x00, 0x83, 0x00, 0x00, 0xE0,
+	0x83, 0xF8, 0x00, 0xE0, 0x84, 0x00, 0x01, 0xE0, 0xF8, 0x80, 0xFF, 0x03, 0xDF, 0xC3, 0xC0, 0xC7,
+	0x81, 0xFF, 0x03, 0xFC, 0xE0, 0x80, 0x1C, 0x81, 0x1F, 0x00, 0x03, 0x84, 0x00, 0x01, 0x01, 0x07,
+	0x81, 0x1F, 0x8E, 0x00, 0x80, 0x00, 0x82, 0xF8, 0x82, 0x18, 0x00, 0x38, 0x80, 0xF8, 0x01, 0xF0,
+	0xE0, 0x81, 0x00, 0x82, 0xFF, 0x81, 0x18, 0x06, 0x3C, 0x3E, 0xFF, 0xF7, 0xE7, 0xE3, 0xC0, 0x80,
+	0x00, 0x82, 0x1F, 0x83, 0x18, 0x01, 0x1C, 0x1F, 0x80, 0x0F, 0x00, 0x07, 0x8E, 0x00, 0x80, 0x00,
+	0x00, 0xC0, 0x80, 0xE0, 0x01, 0xF0, 0x70, 0x80, 0x38, 0x82, 0x18, 0x81, 0x38, 0x00, 0x00, 0x82,
+	0xFF, 0x00, 0xC1, 0x8A, 0x00, 0x00, 0x03, 0x80, 0x07, 0x80, 0x0F, 0x01, 0x1E, 0x1C, 0x83, 0x18,
+	0x80, 0x1C, 0x8E, 0x00, 0x00, 0x00, 0x82, 0xF8, 0x82, 0x18, 0x80, 0x38, 0x00, 0xF8, 0x80, 0xF0,
+	0x02, 0xE0, 0xC0, 0x00, 0x82, 0xFF, 0x85, 0x00, 0x82, 0xFF, 0x00, 0x00, 0x82, 0x1F, 0x82, 0x18,
+	0x80, 0x1C, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x01, 0x8E, 0x00, 0x80, 0x00, 0x83, 0xF8, 0x87, 0x18,
+	0x80, 0x00, 0x83, 0xFF, 0x86, 0x18, 0x81, 0x00, 0x83, 0x1F, 0x87, 0x18, 0x8E, 0x00, 0x81, 0x00,
+	0x82, 0xF8, 0x87, 0x18, 0x81, 0x00, 0x82, 0xFF, 0x87, 0x18, 0x81, 0x00, 0x82, 0x1F, 0x97, 0x00,
+	0x03, 0x00, 0x80, 0xC0, 0xE0, 0x80, 0xF0, 0x00, 0x78, 0x80, 0x38, 0x82, 0x18, 0x80, 0x38, 0x01,
+	0x30, 0x3C, 0x82, 0xFF, 0x00, 0x81, 0x81, 0x00, 0x81, 0x30, 0x82, 0xF0, 0x03, 0x00, 0x01, 0x03,
+	0x07, 0x80, 0x0F, 0x00, 0x1E, 0x80, 0x1C, 0x81, 0x18, 0x81, 0x1F, 0x00, 0x0F, 0x8E, 0x00, 0x00,
+	0x00, 0x83, 0xF8, 0x83, 0x00, 0x83, 0xF8, 0x00, 0x00, 0x83, 0xFF, 0x83, 0x18, 0x83, 0xFF, 0x00,
+	0x00, 0x83, 0x1F, 0x83, 0x00, 0x83, 0x1F, 0x8E, 0x00, 0x80, 0x00, 0x82, 0x18, 0x83, 0xF8, 0x83,
+	0x18, 0x84, 0x00, 0x83, 0xFF, 0x85, 0x00, 0x82, 0x18, 0x83, 0x1F, 0x83, 0x18, 0x8E, 0x00, 0x81,
+	0x00, 0x84, 0x18, 0x83, 0xF8, 0x89, 0x00, 0x83, 0xFF, 0x82, 0x00, 0x81, 0x1C, 0x81, 0x18, 0x01,
+	0x1C, 0x1F, 0x80, 0x0F, 0x00, 0x07, 0x91, 0x00, 0x80, 0x00, 0x82, 0xF8, 0x80, 0x00, 0x07, 0x80,
+	0xC0, 0xE0, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x80, 0x00, 0x82, 0xFF, 0x05, 0x3E, 0x7F, 0xFF, 0xF7,
+	0xE3, 0xC0, 0x84, 0x00, 0x82, 0x1F, 0x81, 0x00, 0x06, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18,
+	0x8E, 0x00, 0x80, 0x00, 0x83, 0xF8, 0x89, 0x00, 0x83, 0xFF, 0x89, 0x00, 0x83, 0x1F, 0x87, 0x18,
+	0x8E, 0x00, 0x83, 0xF8, 0x01, 0xF0, 0xC0, 0x81, 0x00, 0x00, 0xC0, 0x83, 0xF8, 0x82, 0xFF, 0x08,
+	0x0F, 0x3F, 0xFF, 0xFE, 0xF0, 0xFE, 0xFF, 0x1F, 0x03, 0x81, 0xFF, 0x82, 0x1F, 0x80, 0x00, 0x82,
+	0x01, 0x81, 0x00, 0x81, 0x1F, 0x8E, 0x00, 0x00, 0x00, 0x83, 0xF8, 0x01, 0xE0, 0xC0, 0x82, 0x00,
+	0x82, 0xF8, 0x00, 0x00, 0x82, 0xFF, 0x06, 0x07, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8, 0xE0, 0x82, 0xFF,
+	0x00, 0x00, 0x82, 0x1F, 0x82, 0x00, 0x01, 0x01, 0x07, 0x83, 0x1F, 0x8E, 0x00, 0x02, 0x00, 0xC0,
+	0xE0, 0x80, 0xF0, 0x01, 0x78, 0x38, 0x81, 0x18, 0x01, 0x38, 0x78, 0x80, 0xF0, 0x02, 0xE0, 0xC0,
+	0x7E, 0x82, 0xFF, 0x85, 0x00, 0x82, 0xFF, 0x02, 0x00, 0x03, 0x07, 0x80, 0x0F, 0x01, 0x1E, 0x1C,
+	0x81, 0x18, 0x01, 0x1C, 0x1E, 0x80, 0x0F, 0x01, 0x07, 0x03, 0x8E, 0x00, 0x80, 0x00, 0x83, 0xF8,
+	0x82, 0x18, 0x00, 0x38, 0x80, 0xF8, 0x80, 0xF0, 0x80, 0x00, 0x83, 0xFF, 0x81, 0x30, 0x01, 0x38,
+	0x3C, 0x80, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x83, 0x1F, 0x97, 0x00, 0x02, 0x00, 0xC0, 0xE0, 0x80,
+	0xF0, 0x01, 0x78, 0x38, 0x81, 0x18, 0x01, 0x38, 0x78, 0x80, 0xF0, 0x02, 0xE0, 0xC0, 0x7E, 0x82,
+	0xFF, 0x85, 0x00, 0x82, 0xFF, 0x02, 0x00, 0x03, 0x07, 0x80, 0x0F, 0x01, 0x1E, 0x1C, 0x80, 0x18,
+	0x06, 0x38, 0x7C, 0x7E, 0xFF, 0xEF, 0xC7, 0xC3, 0x8C, 0x00, 0x80, 0x01, 0x80, 0x00, 0x82, 0xF8,
+	0x81, 0x18, 0x02, 0x38, 0x78, 0xF8, 0x80, 0xF0, 0x00, 0xE0, 0x81, 0x00, 0x82, 0xFF, 0x01, 0x30,
+	0x70, 0x80, 0xF8, 0x04, 0xFE, 0xDF, 0x8F, 0x0F, 0x03, 0x81, 0x00, 0x82, 0x1F, 0x81, 0x00, 0x02,
+	0x01, 0x03, 0x0F, 0x80, 0x1F, 0x01, 0x1E, 0x18, 0x8E, 0x00, 0x80, 0x00, 0x00, 0xE0, 0x80, 0xF0,
+	0x01, 0xF8, 0x38, 0x83, 0x18, 0x80, 0x38, 0x00, 0x30, 0x81, 0x00, 0x01, 0x03, 0x07, 0x80, 0x0F,
+	0x00, 0x1E, 0x80, 0x1C, 0x03, 0x3C, 0x38, 0x78, 0xF8, 0x80, 0xF0, 0x00, 0xE0, 0x80, 0x00, 0x00,
+	0x0E, 0x81, 0x1C, 0x82, 0x18, 0x01, 0x1C, 0x1E, 0x80, 0x0F, 0x01, 0x07, 0x03, 0x8E, 0x00, 0x84,
+	0x18, 0x83, 0xF8, 0x83, 0x18, 0x84, 0x00, 0x83, 0xFF, 0x89, 0x00, 0x83, 0x1F, 0x93, 0x00, 0x00,
+	0x00, 0x83, 0xF8, 0x84, 0x00, 0x82, 0xF8, 0x00, 0x00, 0x83, 0xFF, 0x84, 0x00, 0x82, 0xFF, 0x80,
+	0x00, 0x00, 0x07, 0x80, 0x0F, 0x01, 0x1F, 0x1C, 0x81, 0x18, 0x01, 0x1C, 0x1F, 0x80, 0x0F, 0x00,
+	0x07, 0x8F, 0x00, 0x00, 0x38, 0x81, 0xF8, 0x01, 0xE0, 0x80, 0x84, 0x00, 0x00, 0xC0, 0x81, 0xF8,
+	0x80, 0x00, 0x01, 0x07, 0x3F, 0x80, 0xFF, 0x04, 0xFC, 0xF0, 0x80, 0xE0, 0xF8, 0x80, 0xFF, 0x01,
+	0x1F, 0x07, 0x84, 0x00, 0x00, 0x07, 0x83, 0x1F, 0x00, 0x07, 0x92, 0x00, 0x81, 0xF8, 0x00, 0xF0,
+	0x80, 0x00, 0x83, 0x80, 0x80, 0x00, 0x00, 0xC0, 0x80, 0xF8, 0x00, 0x03, 0x81, 0xFF, 0x01, 0xF8,
+	0xF0, 0x80, 0xFF, 0x00, 0x3F, 0x80, 0xFF, 0x01, 0xF8, 0xE0, 0x81, 0xFF, 0x01, 0x00, 0x01, 0x83,
+	0x1F, 0x02, 0x03, 0x00, 0x03, 0x83, 0x1F, 0x8F, 0x00, 0x02, 0x08, 0x18, 0x78, 0x80, 0xF8, 0x02,
+	0xF0, 0xE0, 0x80, 0x80, 0x00, 0x05, 0xC0, 0xE0, 0xF0, 0xF8, 0x78, 0x18, 0x82, 0x00, 0x01, 0xC1,
+	0xE7, 0x80, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x02, 0xE3, 0xC1, 0x80, 0x80, 0x00, 0x06, 0x10, 0x1C,
+	0x1E, 0x1F, 0x0F, 0x03, 0x01, 0x80, 0x00, 0x02, 0x01, 0x03, 0x07, 0x80, 0x1F, 0x01, 0x1E, 0x1C,
+	0x8E, 0x00, 0x01, 0x08, 0x38, 0x81, 0xF8, 0x01, 0xE0, 0x80, 0x82, 0x00, 0x01, 0xC0, 0xE0, 0x80,
+	0xF8, 0x00, 0x38, 0x81, 0x00, 0x02, 0x01, 0x07, 0x0F, 0x80, 0xFF, 0x05, 0xFC, 0xFE, 0xFF, 0x0F,
+	0x07, 0x01, 0x86, 0x00, 0x83, 0x1F, 0x93, 0x00, 0x00, 0x00, 0x87, 0x18, 0x01, 0x98, 0xD8, 0x81,
+	0xF8, 0x00, 0x78, 0x82, 0x00, 0x09, 0xC0, 0xE0, 0xF0, 0xF8, 0x7E, 0x3F, 0x1F, 0x07, 0x03, 0x01,
+	0x81, 0x00, 0x01, 0x1C, 0x1E, 0x81, 0x1F, 0x00, 0x1B, 0x87, 0x18, 0x8E, 0x00, 0x83, 0x00, 0x82,
+	0xFF, 0x85, 0x01, 0x83, 0x00, 0x82, 0xFF, 0x8A, 0x00, 0x82, 0xFF, 0x85, 0x80, 0x83, 0x00, 0x89,
+	0x01, 0x07, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x8B, 0x00, 0x06, 0x03, 0x0F, 0x3F,
+	0xFF, 0xFC, 0xF0, 0xC0, 0x8B, 0x00, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x8B, 0x00,
+	0x81, 0x01, 0x00, 0x00, 0x85, 0x01, 0x82, 0xFF, 0x8A, 0x00, 0x82, 0xFF, 0x83, 0x00, 0x85, 0x80,
+	0x82, 0xFF, 0x83, 0x00, 0x89, 0x01, 0x82, 0x00, 0x83, 0x00, 0x07, 0xE0, 0xF8, 0xFE, 0x7F, 0xFF,
+	0xF8, 0xE0, 0x80, 0x82, 0x00, 0x0F, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x01, 0x0F,
+	0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x82, 0x01, 0x86, 0x00, 0x81, 0x01, 0x8E, 0x00, 0x9E, 0x00,
+	0x8E, 0x60, 0x8E, 0x00, 0x86, 0x00, 0x82, 0x01, 0xB2, 0x00, 0x80, 0x00, 0x80, 0x80, 0x87, 0xC0,
+	0x00, 0x80, 0x81, 0x00, 0x01, 0x80, 0xC1, 0x80, 0xE1, 0x01, 0xF1, 0x70, 0x80, 0x30, 0x00, 0x31,
+	0x82, 0xFF, 0x00, 0xFE, 0x80, 0x00, 0x01, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x1E, 0x81, 0x18, 0x00,
+	0x1C, 0x80, 0x0F, 0x81, 0x1F, 0x00, 0x18, 0x8E, 0x00, 0x80, 0x00, 0x82, 0xFF, 0x00, 0x80, 0x84,
+	0xC0, 0x80, 0x80, 0x81, 0x00, 0x82, 0xFF, 0x01, 0x03, 0x01, 0x80, 0x00, 0x01, 0x01, 0x03, 0x81,
+	0xFF, 0x00, 0xFE, 0x80, 0x00, 0x81, 0x1F, 0x00, 0x0F, 0x80, 0x1C, 0x80, 0x18, 0x01, 0x1C, 0x1F,
+	0x80, 0x0F, 0x01, 0x07, 0x01, 0x8E, 0x00, 0x82, 0x00, 0x80, 0x80, 0x87, 0xC0, 0x03, 0x80, 0x00,
+	0x70, 0xFE, 0x81, 0xFF, 0x00, 0x07, 0x80, 0x01, 0x82, 0x00, 0x81, 0x01, 0x80, 0x00, 0x01, 0x03,
+	0x07, 0x80, 0x0F, 0x00, 0x1F, 0x80, 0x1C, 0x82, 0x18, 0x80, 0x1C, 0x00, 0x0C, 0x8E, 0x00, 0x81,
+	0x00, 0x80, 0x80, 0x84, 0xC0, 0x83, 0xFF, 0x01, 0x00, 0xFC, 0x81, 0xFF, 0x01, 0x9F, 0x01, 0x81,
+	0x00, 0x00, 0x01, 0x83, 0xFF, 0x03, 0x00, 0x01, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0x80, 0x18,
+	0x01, 0x1C, 0x0E, 0x83, 0x1F, 0x8E, 0x00, 0x82, 0x00, 0x80, 0x80, 0x85, 0xC0, 0x00, 0x80, 0x81,
+	0x00, 0x01, 0xF8, 0xFE, 0x81, 0xFF, 0x01, 0x33, 0x31, 0x80, 0x30, 0x00, 0x31, 0x82, 0x3F, 0x00,
+	0x3C, 0x80, 0x00, 0x01, 0x03, 0x07, 0x80, 0x0F, 0x01, 0x1E, 0x1C, 0x83, 0x18, 0x80, 0x1C, 0x00,
+	0x0C, 0x8E, 0x00, 0x00, 0x00, 0x82, 0xC0, 0x01, 0xF8, 0xFE, 0x81, 0xFF, 0x00, 0xC3, 0x82, 0xC1,
+	0x00, 0xC3, 0x83, 0x00, 0x83, 0xFF, 0x89, 0x00, 0x83, 0x1F, 0x94, 0x00, 0x81, 0x00, 0x80, 0x80,
+	0x84, 0xC0, 0x00, 0x80, 0x82, 0xC0, 0x01, 0x00, 0xFC, 0x81, 0xFF, 0x01, 0x8F, 0x01, 0x80, 0x00,
+	0x80, 0x01, 0x83, 0xFF, 0x03, 0x00, 0x01, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0x80, 0x18, 0x01,
+	0x1C, 0x0E, 0x82, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x81, 0x03, 0x82, 0x02, 0x82, 0x03, 0x00, 0x01,
+	0x80, 0x00, 0x80, 0x00, 0x82, 0xFF, 0x00, 0x80, 0x85, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x82, 0xFF,
+	0x02, 0x07, 0x03, 0x01, 0x80, 0x00, 0x82, 0xFF, 0x00, 0xFE, 0x80, 0x00, 0x82, 0x1F, 0x83, 0x00,
+	0x83, 0x1F, 0x8E, 0x00, 0x00, 0x00, 0x84, 0xC0, 0x82, 0xC3, 0x00, 0x03, 0x89, 0x00, 0x82, 0xFF,
+	0x8A, 0x00, 0x82, 0x1F, 0x93, 0x00, 0x80, 0x00, 0x84, 0xC0, 0x83, 0xC3, 0x89, 0x00, 0x83, 0xFF,
+	0x89, 0x00, 0x82, 0xFF, 0x00, 0x7F, 0x82, 0x00, 0x81, 0x03, 0x81, 0x02, 0x82, 0x03, 0x00, 0x01,
+	0x82, 0x00, 0x80, 0x00, 0x82, 0xFF, 0x82, 0x00, 0x00, 0x80, 0x82, 0xC0, 0x00, 0x40, 0x80, 0x00,
+	0x82, 0xFF, 0x07, 0x70, 0xFC, 0xFE, 0xFF, 0xCF, 0x87, 0x03, 0x01, 0x82, 0x00, 0x82, 0x1F, 0x80,
+	0x00, 0x02, 0x01, 0x03, 0x07, 0x80, 0x1F, 0x02, 0x1E, 0x1C, 0x18, 0x8E, 0x00, 0x00, 0x00, 0x84,
+	0x01, 0x83, 0xFF, 0x89, 0x00, 0x83, 0xFF, 0x89, 0x00, 0x83, 0x1F, 0x92, 0x00, 0x82, 0xC0, 0x00,
+	0x80, 0x82, 0xC0, 0x80, 0x80, 0x82, 0xC0, 0x00, 0x80, 0x82, 0xFF, 0x02, 0x0F, 0x03, 0x07, 0x81,
+	0xFF, 0x00, 0x0F, 0x80, 0x03, 0x81, 0xFF, 0x82, 0x1F, 0x81, 0x00, 0x81, 0x1F, 0x81, 0x00, 0x81,
+	0x1F, 0x8E, 0x00, 0x80, 0x00, 0x82, 0xC0, 0x00, 0x80, 0x85, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x82,
+	0xFF, 0x02, 0x07, 0x03, 0x01, 0x80, 0x00, 0x82, 0xFF, 0x00, 0xFE, 0x80, 0x00, 0x82, 0x1F, 0x83,
+	0x00, 0x83, 0x1F, 0x8E, 0x00, 0x81, 0x00, 0x80, 0x80, 0x85, 0xC0, 0x80, 0x80, 0x81, 0x00, 0x00,
+	0xFC, 0x81, 0xFF, 0x01, 0x07, 0x01, 0x81, 0x00, 0x01, 0x01, 0x07, 0x81, 0xFF, 0x03, 0xFE, 0x00,
+	0x01, 0x07, 0x80, 0x0F, 0x01, 0x1F, 0x1C, 0x81, 0x18, 0x01, 0x1C, 0x1F, 0x80, 0x0F, 0x01, 0x07,
+	0x03, 0x8E, 0x00, 0x80, 0x00, 0x82, 0xC0, 0x00, 0x80, 0x84, 0xC0, 0x80, 0x80, 0x81, 0x00, 0x82,
+	0xFF, 0x01, 0x03, 0x01, 0x80, 0x00, 0x01, 0x01, 0x03, 0x81, 0xFF, 0x00, 0xFE, 0x80, 0x00, 0x82,
+	0xFF, 0x01, 0x1E, 0x1C, 0x80, 0x18, 0x00, 0x1C, 0x80, 0x1F, 0x02, 0x0F, 0x07, 0x01, 0x80, 0x00,
+	0x82, 0x03, 0x88, 0x00, 0x81, 0x00, 0x80, 0x80, 0x84, 0xC0, 0x00, 0x80, 0x81, 0xC0, 0x80, 0x00,
+	0x00, 0xFC, 0x81, 0xFF, 0x01, 0x07, 0x01, 0x80, 0x00, 0x80, 0x01, 0x82, 0xFF, 0x80, 0x00, 0x02,
+	0x03, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0x80, 0x18, 0x01, 0x1C, 0x0E, 0x82, 0xFF, 0x8A, 0x00,
+	0x82, 0x03, 0x00, 0x00, 0x81, 0x00, 0x83, 0xC0, 0x00, 0x80, 0x85, 0xC0, 0x81, 0x00, 0x83, 0xFF,
+	0x02, 0x07, 0x03, 0x01, 0x80, 0x00, 0x81, 0x07, 0x81, 0x00, 0x83, 0x1F, 0x96, 0x00, 0x81, 0x00,
+	0x80, 0x80, 0x87, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x00, 0x0E, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x38,
+	0x80, 0x70, 0x01, 0xF0, 0xE0, 0x80, 0xE1, 0x00, 0xC1, 0x81, 0x00, 0x00, 0x0C, 0x81, 0x1C, 0x82,
+	0x18, 0x01, 0x1C, 0x1F, 0x80, 0x0F, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x82, 0xC0, 0x82, 0xF8,
+	0x85, 0xC0, 0x83, 0x00, 0x82, 0xFF, 0x8A, 0x00, 0x01, 0x07, 0x0F, 0x80, 0x1F, 0x00, 0x1C, 0x84,
+	0x18, 0x8E, 0x00, 0x80, 0x00, 0x82, 0xC0, 0x83, 0x00, 0x82, 0xC0, 0x81, 0x00, 0x82, 0xFF, 0x83,
+	0x00, 0x82, 0xFF, 0x81, 0x00, 0x01, 0x07, 0x0F, 0x80, 0x1F, 0x04, 0x1C, 0x18, 0x1C, 0x1E, 0x0F,
+	0x82, 0x1F, 0x8F, 0x00, 0x00, 0x40, 0x81, 0xC0, 0x00, 0x80, 0x85, 0x00, 0x00, 0x80, 0x81, 0xC0,
+	0x0F, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF0, 0xFE, 0xFF, 0x3F, 0x0F,
+	0x01, 0x82, 0x00, 0x01, 0x01, 0x07, 0x83, 0x1F, 0x00, 0x07, 0x92, 0x00, 0x82, 0xC0, 0x81, 0x00,
+	0x82, 0x80, 0x81, 0x00, 0x80, 0xC0, 0x00, 0x0F, 0x81, 0xFF, 0x80, 0xF0, 0x80, 0xFF, 0x00, 0x1F,
+	0x80, 0xFF, 0x02, 0xFC, 0xC0, 0xFE, 0x80, 0xFF, 0x01, 0x00, 0x01, 0x83, 0x1F, 0x02, 0x01, 0x00,
+	0x01, 0x83, 0x1F, 0x00, 0x01, 0x8E, 0x00, 0x01, 0x00, 0x40, 0x82, 0xC0, 0x00, 0x80, 0x82, 0x00,
+	0x00, 0x80, 0x81, 0xC0, 0x00, 0x40, 0x80, 0x00, 0x05, 0x01, 0x03, 0x07, 0xDF, 0xFF, 0xFE, 0x80,
+	0xFC, 0x03, 0xFF, 0xDF, 0x87, 0x03, 0x81, 0x00, 0x05, 0x10, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x80,
+	0x01, 0x01, 0x03, 0x07, 0x80, 0x1F, 0x02, 0x1E, 0x1C, 0x18, 0x8E, 0x00, 0x00, 0x40, 0x82, 0xC0,
+	0x85, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x03, 0x00, 0x01, 0x07, 0x3F, 0x80, 0xFF, 0x09, 0xF8, 0xE0,
+	0x80, 0xC0, 0xF8, 0xFE, 0xFF, 0x3F, 0x07, 0x01, 0x83, 0x00, 0x00, 0x83, 0x81, 0xFF, 0x02, 0x7F,
+	0x0F, 0x03, 0x83, 0x00, 0x81, 0x02, 0x82, 0x03, 0x00, 0x01, 0x85, 0x00, 0x80, 0x00, 0x8C, 0xC0,
+	0x82, 0x00, 0x0E, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00,
+	0x18, 0x1C, 0x81, 0x1F, 0x01, 0x1B, 0x19, 0x86, 0x18, 0x8E, 0x00, 0x84, 0x00, 0x00, 0x3E, 0x81,
+	0xFF, 0x00, 0xC3, 0x82, 0x01, 0x81, 0x00, 0x82, 0x18, 0x00, 0x3C, 0x80, 0xFF, 0x01, 0xE7, 0x81,
+	0x89, 0x00, 0x00, 0x7C, 0x81, 0xFF, 0x00, 0xC3, 0x82, 0x80, 0x88, 0x00, 0x84, 0x01, 0x00, 0x00,
+	0x85, 0x00, 0x81, 0xFF, 0x8B, 0x00, 0x81, 0xFF, 0x8B, 0x00, 0x81, 0xFF, 0x8B, 0x00, 0x81, 0x01,
+	0x84, 0x00, 0x80, 0x00, 0x82, 0x01, 0x00, 0x83, 0x81, 0xFF, 0x00, 0x3E, 0x89, 0x00, 0x01, 0x81,
+	0xE7, 0x80, 0xFF, 0x00, 0x3C, 0x82, 0x18, 0x81, 0x00, 0x82, 0x80, 0x00, 0xC1, 0x81, 0xFF, 0x00,
+	0x7C, 0x85, 0x00, 0x84, 0x01, 0x86, 0x00, 0x8E, 0x00, 0x01, 0xC0, 0xF0, 0x80, 0xF8, 0x80, 0x18,
+	0x04, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0x80, 0xC0, 0x80, 0xF8, 0x00, 0x78, 0x9E, 0x00,
+};
+
+FontPageDef_t Font_16x26_Rle = {
+	16,
+	26,
+	32,
+	126,
+	Font_16x26_Rle_Data,
+	FONTS_FORMAT_RLE,
+	Font_16x26_Rle_Index,
+	NULL,
+	95,
+	NULL,
+	0
+};
@@ -25,6 +25,14 @@ typedef struct
 	uint16_t current_y;
 	uint8_t inverted;
 	uint8_t initialized;
+	uint8_t transparent;
+	uint8_t scrolling;
+	uint8_t scroll_skipped;   // Scrolled pages were not sent by an update
+	uint16_t band_first;      // First page of the target held in its buffer
+	uint16_t band_pages;      // Pages of the target held in its buffer
+	uint8_t rotation;         // ssd1306_rotation_t
+	const uint8_t* pattern;   // Column bytes of the fill pattern, NULL for solid fills
+	uint8_t pattern_transparent;
 } ssd1306_work_t;
 
 /* Private define ------------------------------------------------------------*/
@@ -37,15 +45,105 @@ typedef struct
 #define SSD1306_SET_VERTICAL_SCROLL_AREA             (0xA3) // Set scroll range
 #define SSD1306_NORMALDISPLAY						 (0xA6)
 #define SSD1306_INVERTDISPLAY						 (0xA7)
+#define SSD1306_SEGREMAP                             (0xA0) // Column 0 on SEG0, 0xA1 for SEG127
+#define SSD1306_COMSCANINC                           (0xC0) // Scan COM0 first, 0xC8 for COM63
+
+#define SSD1306_GLYPH_BUFFER_SIZE                    (16 * (SSD1306_HEIGHT / 8)) // Widest FontDef_t glyph
+#define SSD1306_SCALE_MAX                            (4)
+
+#if SSD1306_FRAMEBUFFER
+#define SSD1306_SCREEN_CANVAS                        { ssd1306_buffer, SSD1306_WIDTH, SSD1306_HEIGHT, SSD1306_WIDTH }
+#define SSD1306_SCREEN_PAGES                         (SSD1306_HEIGHT / 8)
+#else
+#define SSD1306_SCREEN_CANVAS                        { NULL, 0, 0, 0 } // Nothing is drawn until a canvas is selected
+#define SSD1306_SCREEN_PAGES                         (0)
+#endif
 
 /* Private macro -------------------------------------------------------------*/
 #define ABS(x) ((x) > 0 ? (x) : -(x))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* Exported variables --------------------------------------------------------*/
+const uint8_t ssd1306_init_sequence[SSD1306_INIT_SEQUENCE_SIZE] = {
+	0xAE,       //display off
+	0x20, 0x10, //Set Memory Addressing Mode: 00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
+	0xB0,       //Set Page Start Address for Page Addressing Mode,0-7
+	0xC8,       //Set COM Output Scan Direction
+	0x00,       //---set low column address
+	0x10,       //---set high column address
+	0x40,       //--set start line address
+	0x81, 0xFF, //--set contrast control register
+	0xA1,       //--set segment re-map 0 to 127
+	0xA6,       //--set normal display
+	0xA8, 0x3F, //--set multiplex ratio(1 to 64)
+	0xA4,       //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
+	0xD3, 0x00, //-set display offset: not offset
+	0xD5, 0xF0, //--set display clock divide ratio/oscillator frequency: divide ratio
+	0xD9, 0x22, //--set pre-charge period
+	0xDA, 0x12, //--set com pins hardware configuration
+	0xDB, 0x20, //--set vcomh: 0x20,0.77xVcc
+	0x8D, 0x14, //--set DC-DC enable
+	0xAF,       //--turn on ssd1306_work panel
+};
+
+/* Fill patterns, one byte per column of an 8x8 tile */
+const ssd1306_pattern_t ssd1306_pattern_checker = { { 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA } };
+const ssd1306_pattern_t ssd1306_pattern_diagonal = { { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 } };
+const ssd1306_pattern_t ssd1306_pattern_horizontal = { { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11 } };
+const ssd1306_pattern_t ssd1306_pattern_vertical = { { 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00 } };
 
 /* Private variables ---------------------------------------------------------*/
+#if SSD1306_FRAMEBUFFER
 static uint8_t ssd1306_buffer[(SSD1306_WIDTH * SSD1306_HEIGHT) / 8];
-static ssd1306_work_t ssd1306_work;
+#endif
+static ssd1306_work_t ssd1306_work = { 0, 0, 0, 0, 0, 0, 0, 0, SSD1306_SCREEN_PAGES, ssd1306_rotation_0, NULL, 0 };
+static ssd1306_canvas_t ssd1306_screen = SSD1306_SCREEN_CANVAS;   // 64 x 128 in portrait
+static ssd1306_canvas_t ssd1306_target = SSD1306_SCREEN_CANVAS; // Drawing functions write here
+static ssd1306_scroll_t ssd1306_scroll;
+
+/* Frames per scroll step, indexed by ssd1306_scroll_speed_t */
+static const uint16_t ssd1306_scroll_frames[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+/* Every bit of a nibble repeated 2, 3 or 4 times, LSB first */
+static const uint16_t ssd1306_expand[SSD1306_SCALE_MAX - 1][16] = {
+	{ 0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+	  0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF },
+	{ 0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF,
+	  0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF },
+	{ 0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+	  0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF },
+};
+
+/* 8x8 Bayer threshold matrix, row by row */
+static const uint8_t ssd1306_bayer[8][8] = {
+	{  0, 32,  8, 40,  2, 34, 10, 42 },
+	{ 48, 16, 56, 24, 50, 18, 58, 26 },
+	{ 12, 44,  4, 36, 14, 46,  6, 38 },
+	{ 60, 28, 52, 20, 62, 30, 54, 22 },
+	{  3, 35, 11, 43,  1, 33,  9, 41 },
+	{ 51, 19, 59, 27, 49, 17, 57, 25 },
+	{ 15, 47,  7, 39, 13, 45,  5, 37 },
+	{ 63, 31, 55, 23, 61, 29, 53, 21 },
+};
 
 /* Private function prototypes -----------------------------------------------*/
+static void ssd1306_write_column(int16_t x, int16_t y, uint8_t bits, uint8_t mask);
+static void ssd1306_transpose_glyph(char ch, FontDef_t* Font, uint8_t* columns);
+static uint32_t ssd1306_expand_byte(uint8_t value, uint8_t scale);
+static void ssd1306_write_glyph(int16_t x, int16_t y, uint8_t value, uint8_t mask, uint8_t invert, uint8_t transparent);
+static void ssd1306_fill_area(int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_color_t color);
+static void ssd1306_fill_pattern(int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_color_t color);
+static void ssd1306_blit_columns(int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, uint8_t invert, uint8_t transparent);
+static void ssd1306_draw_packed(int16_t x, int16_t y, const FontPageDef_t* Font, const uint8_t* glyph, uint8_t invert, uint8_t transparent);
+static void ssd1306_draw_rle(int16_t x, int16_t y, const uint8_t* src, uint16_t w, uint16_t h, uint8_t invert, uint8_t transparent);
+static uint16_t ssd1306_put_glyph(uint16_t ch, const FontPageDef_t* Font, ssd1306_color_t color, uint8_t background);
+static uint8_t ssd1306_page_scrolling(uint8_t page);
+static void ssd1306_reverse(uint8_t* data, uint16_t n);
+static void ssd1306_select_target(const ssd1306_canvas_t* canvas, uint16_t first, uint16_t pages);
+static uint8_t* ssd1306_target_page(uint16_t page);
+static void ssd1306_update_portrait(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static void ssd1306_transpose(const uint8_t* in, uint8_t* out);
+
 /* Private user code ---------------------------------------------------------*/
 
 uint8_t ssd1306_init(void)
@@ -61,36 +159,19 @@ uint8_t ssd1306_init(void)
 	while(p>0) p--;
 
 	/* Init LCD */
-	ssd1306_i2c_command(0xAE); //display off
-	ssd1306_i2c_command(0x20); //Set Memory Addressing Mode
-	ssd1306_i2c_command(0x10); //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
-	ssd1306_i2c_command(0xB0); //Set Page Start Address for Page Addressing Mode,0-7
-	ssd1306_i2c_command(0xC8); //Set COM Output Scan Direction
-	ssd1306_i2c_command(0x00); //---set low column address
-	ssd1306_i2c_command(0x10); //---set high column address
-	ssd1306_i2c_command(0x40); //--set start line address
-	ssd1306_i2c_command(0x81); //--set contrast control register
-	ssd1306_i2c_command(0xFF);
-	ssd1306_i2c_command(0xA1); //--set segment re-map 0 to 127
-	ssd1306_i2c_command(0xA6); //--set normal display
-	ssd1306_i2c_command(0xA8); //--set multiplex ratio(1 to 64)
-	ssd1306_i2c_command(0x3F); //
-	ssd1306_i2c_command(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
-	ssd1306_i2c_command(0xD3); //-set display offset
-	ssd1306_i2c_command(0x00); //-not offset
-	ssd1306_i2c_command(0xD5); //--set display clock divide ratio/oscillator frequency
-	ssd1306_i2c_command(0xF0); //--set divide ratio
-	ssd1306_i2c_command(0xD9); //--set pre-charge period
-	ssd1306_i2c_command(0x22); //
-	ssd1306_i2c_command(0xDA); //--set com pins hardware configuration
-	ssd1306_i2c_command(0x12);
-	ssd1306_i2c_command(0xDB); //--set vcomh
-	ssd1306_i2c_command(0x20); //0x20,0.77xVcc
-	ssd1306_i2c_command(0x8D); //--set DC-DC enable
-	ssd1306_i2c_command(0x14); //
-	ssd1306_i2c_command(0xAF); //--turn on ssd1306_work panel
+	for (p = 0; p < SSD1306_INIT_SEQUENCE_SIZE; p++)
+	{
+		ssd1306_i2c_command(ssd1306_init_sequence[p]);
+	}
 
 	ssd1306_i2c_command(SSD1306_DEACTIVATE_SCROLL);
+	ssd1306_work.scrolling = 0;
+
+	/* Orientation set before init */
+	if (ssd1306_work.rotation != ssd1306_rotation_0)
+	{
+		ssd1306_set_rotation((ssd1306_rotation_t)ssd1306_work.rotation);
+	}
 
 	/* Clear screen */
 	ssd1306_fill(ssd1306_color_black);
@@ -112,72 +193,480 @@ void ssd1306_update_screen(void)
 {
 	uint8_t m;
 
-	for (m = 0; m < 8; m++)
+	if (ssd1306_screen.width < ssd1306_screen.height)
+	{
+		ssd1306_update_portrait(0, 0, ssd1306_screen.width, ssd1306_screen.height);
+		return;
+	}
+
+	for (m = 0; m < FONTS_PAGES(ssd1306_screen.height); m++)
 	{
+		if (ssd1306_page_scrolling(m))
+		{
+			continue;
+		}
+
 		ssd1306_i2c_command(0xB0 + m);
 		ssd1306_i2c_command(0x00);
 		ssd1306_i2c_command(0x10);
 
 		/* Write multi data */
-		ssd1306_i2c_write_multi(0x40, &ssd1306_buffer[SSD1306_WIDTH * m], SSD1306_WIDTH);
+		ssd1306_i2c_write_multi(0x40, &ssd1306_screen.buffer[SSD1306_WIDTH * m], SSD1306_WIDTH);
+	}
+}
+
+void ssd1306_update_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	uint8_t m;
+
+	/* Check input parameters */
+	if ((x >= ssd1306_screen.width) || (y >= ssd1306_screen.height) || (w == 0) || (h == 0))
+	{
+		return;
+	}
+
+	/* Check width and height */
+	if ((x + w) > ssd1306_screen.width)
+	{
+		w = ssd1306_screen.width - x;
+	}
+	if ((y + h) > ssd1306_screen.height)
+	{
+		h = ssd1306_screen.height - y;
+	}
+
+	if (ssd1306_screen.width < ssd1306_screen.height)
+	{
+		ssd1306_update_portrait(x, y, w, h);
+		return;
+	}
+
+	for (m = y / 8; m <= (y + h - 1) / 8; m++)
+	{
+		if (ssd1306_page_scrolling(m))
+		{
+			continue;
+		}
+
+		ssd1306_i2c_command(0xB0 + m);
+		ssd1306_i2c_command(0x00 | (x & 0x0F));
+		ssd1306_i2c_command(0x10 | (x >> 4));
+
+		/* Write multi data */
+		ssd1306_i2c_write_multi(0x40, &ssd1306_screen.buffer[SSD1306_WIDTH * m + x], w);
+	}
+}
+
+void ssd1306_canvas_init(ssd1306_canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h)
+{
+	canvas->buffer = buffer;
+	canvas->width = w;
+	canvas->height = h;
+	canvas->stride = w;
+}
+
+void ssd1306_canvas_view(ssd1306_canvas_t* view, const ssd1306_canvas_t* parent, uint16_t x, uint16_t page, uint16_t w, uint16_t h)
+{
+	/* Check input parameters */
+	if ((x >= parent->width) || (page * 8 >= parent->height))
+	{
+		w = 0;
+		h = 0;
+		x = 0;
+		page = 0;
+	}
+
+	/* Check width and height */
+	if ((x + w) > parent->width)
+	{
+		w = parent->width - x;
+	}
+	if ((page * 8 + h) > parent->height)
+	{
+		h = parent->height - page * 8;
+	}
+
+	view->buffer = &parent->buffer[page * parent->stride + x];
+	view->width = w;
+	view->height = h;
+	view->stride = parent->stride;
+}
+
+void ssd1306_set_canvas(const ssd1306_canvas_t* canvas)
+{
+	if (canvas == NULL)
+	{
+		canvas = &ssd1306_screen;
+	}
+
+	ssd1306_select_target(canvas, 0, FONTS_PAGES(canvas->height));
+}
+
+void ssd1306_set_page_canvas(uint8_t* buffer, uint8_t page)
+{
+	ssd1306_canvas_t canvas = { buffer, SSD1306_WIDTH, SSD1306_HEIGHT, SSD1306_WIDTH };
+
+	/* Screen sized canvas of which only one page is in memory */
+	ssd1306_select_target(&canvas, page, (page < (SSD1306_HEIGHT / 8)) ? 1 : 0);
+}
+
+const ssd1306_canvas_t* ssd1306_get_screen(void)
+{
+	return &ssd1306_screen;
+}
+
+void ssd1306_canvas_blit(ssd1306_canvas_t* dst, int16_t x, int16_t y, const ssd1306_canvas_t* src, int16_t sx, int16_t sy, int16_t w, int16_t h)
+{
+	const uint8_t *upper, *lower;
+	int16_t row, end, first, pages, i;
+	uint8_t shift, rows, mask, value;
+	uint8_t* out;
+
+	if (dst == NULL)
+	{
+		dst = (ssd1306_canvas_t*)&ssd1306_screen;
+	}
+
+	/* Clip to source */
+	if (sx < 0)
+	{
+		w += sx;
+		x -= sx;
+		sx = 0;
+	}
+	if (sy < 0)
+	{
+		h += sy;
+		y -= sy;
+		sy = 0;
+	}
+	if ((sx + w) > src->width)
+	{
+		w = src->width - sx;
+	}
+	if ((sy + h) > src->height)
+	{
+		h = src->height - sy;
+	}
+
+	/* Clip to destination */
+	if (x < 0)
+	{
+		w += x;
+		sx -= x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		sy -= y;
+		y = 0;
+	}
+	if ((x + w) > dst->width)
+	{
+		w = dst->width - x;
+	}
+	if ((y + h) > dst->height)
+	{
+		h = dst->height - y;
+	}
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
+	pages = FONTS_PAGES(src->height);
+	for (row = y, end = y + h; row < end; row += rows)
+	{
+		/* Rows of this destination page inside the rectangle */
+		rows = 8 - (row % 8);
+		if (rows > (end - row))
+		{
+			rows = end - row;
+		}
+		mask = (0xFF >> (8 - rows)) << (row % 8);
+
+		/* Source row matching bit 0 of the destination page, spread over two source pages */
+		first = sy + (row - (row % 8)) - y;
+		shift = (first + 8) % 8;
+		first = (first + 8) / 8 - 1;
+		lower = (first >= 0) ? &src->buffer[first * src->stride + sx] : NULL;
+		upper = ((shift != 0) && (first + 1 < pages)) ? &src->buffer[(first + 1) * src->stride + sx] : NULL;
+		out = (dst == &ssd1306_target) ? ssd1306_target_page(row / 8) : &dst->buffer[(row / 8) * dst->stride];
+		if (out == NULL)
+		{
+			continue;
+		}
+		out += x;
+
+		if ((shift == 0) && (mask == 0xFF))
+		{
+			/* Aligned whole pages are plain copies */
+			memcpy(out, lower, w);
+			continue;
+		}
+
+		for (i = 0; i < w; i++)
+		{
+			value = ((lower != NULL) ? (lower[i] >> shift) : 0) | ((upper != NULL) ? (upper[i] << (8 - shift)) : 0);
+
+			out[i] = (out[i] & ~mask) | (value & mask);
+		}
 	}
 }
 
+void ssd1306_draw_canvas(int16_t x, int16_t y, const ssd1306_canvas_t* canvas)
+{
+	ssd1306_canvas_blit(&ssd1306_target, x, y, canvas, 0, 0, canvas->width, canvas->height);
+}
+
 void ssd1306_scroll_right(uint8_t start_row, uint8_t end_row)
 {
-	ssd1306_i2c_command(SSD1306_RIGHT_HORIZONTAL_SCROLL);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(start_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(end_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(0XFF);
-	ssd1306_i2c_command(SSD1306_ACTIVATE_SCROLL);
+	ssd1306_scroll_t scroll = { ssd1306_scroll_dir_right, ssd1306_scroll_frames_5, start_row, end_row, 0, SSD1306_WIDTH - 1, 0 };
+
+	ssd1306_scroll_start(&scroll);
 }
 
 void ssd1306_scroll_left(uint8_t start_row, uint8_t end_row)
 {
-	ssd1306_i2c_command(SSD1306_LEFT_HORIZONTAL_SCROLL);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(start_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(end_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(0XFF);
-	ssd1306_i2c_command(SSD1306_ACTIVATE_SCROLL);
+	ssd1306_scroll_t scroll = { ssd1306_scroll_dir_left, ssd1306_scroll_frames_5, start_row, end_row, 0, SSD1306_WIDTH - 1, 0 };
+
+	ssd1306_scroll_start(&scroll);
 }
 
 void ssd1306_scroll_diag_right(uint8_t start_row, uint8_t end_row)
 {
-	ssd1306_i2c_command(SSD1306_SET_VERTICAL_SCROLL_AREA);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(SSD1306_HEIGHT);
-	ssd1306_i2c_command(SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(start_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(end_row);
-	ssd1306_i2c_command(0x01);
-	ssd1306_i2c_command(SSD1306_ACTIVATE_SCROLL);
+	ssd1306_scroll_t scroll = { ssd1306_scroll_dir_right, ssd1306_scroll_frames_5, start_row, end_row, 0, SSD1306_WIDTH - 1, 1 };
+
+	ssd1306_set_vertical_scroll_area(0, SSD1306_HEIGHT);
+	ssd1306_scroll_start(&scroll);
 }
 
 void ssd1306_scroll_diag_left(uint8_t start_row, uint8_t end_row)
 {
-	ssd1306_i2c_command(SSD1306_SET_VERTICAL_SCROLL_AREA);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(SSD1306_HEIGHT);
-	ssd1306_i2c_command(SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL);
-	ssd1306_i2c_command(0x00);
-	ssd1306_i2c_command(start_row);
-	ssd1306_i2c_command(0X00);
-	ssd1306_i2c_command(end_row);
-	ssd1306_i2c_command(0x01);
+	ssd1306_scroll_t scroll = { ssd1306_scroll_dir_left, ssd1306_scroll_frames_5, start_row, end_row, 0, SSD1306_WIDTH - 1, 1 };
+
+	ssd1306_set_vertical_scroll_area(0, SSD1306_HEIGHT);
+	ssd1306_scroll_start(&scroll);
+}
+
+void ssd1306_scroll_start(const ssd1306_scroll_t* scroll)
+{
+	uint8_t right = scroll->direction == ssd1306_scroll_dir_right;
+
+	/* Parameters must not change while scrolling */
+	ssd1306_i2c_command(SSD1306_DEACTIVATE_SCROLL);
+
+	if (scroll->vertical_offset == 0)
+	{
+		ssd1306_i2c_command(right ? SSD1306_RIGHT_HORIZONTAL_SCROLL : SSD1306_LEFT_HORIZONTAL_SCROLL);
+		ssd1306_i2c_command(0x00);
+		ssd1306_i2c_command(scroll->start_page);
+		ssd1306_i2c_command(scroll->speed);
+		ssd1306_i2c_command(scroll->end_page);
+#if SSD1306_SCROLL_COLUMNS
+		ssd1306_i2c_command(scroll->start_column);
+		ssd1306_i2c_command(scroll->end_column);
+#else
+		ssd1306_i2c_command(0x00);
+		ssd1306_i2c_command(0xFF);
+#endif
+	}
+	else
+	{
+		ssd1306_i2c_command(right ? SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL : SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL);
+		ssd1306_i2c_command(0x00);
+		ssd1306_i2c_command(scroll->start_page);
+		ssd1306_i2c_command(scroll->speed);
+		ssd1306_i2c_command(scroll->end_page);
+		ssd1306_i2c_command(scroll->vertical_offset);
+	}
 	ssd1306_i2c_command(SSD1306_ACTIVATE_SCROLL);
+
+	ssd1306_scroll = *scroll;
+	ssd1306_work.scroll_skipped = 0;
+#if !SSD1306_SCROLL_COLUMNS
+	ssd1306_scroll.start_column = 0;
+	ssd1306_scroll.end_column = SSD1306_WIDTH - 1;
+#endif
+	ssd1306_work.scrolling = 1;
+}
+
+void ssd1306_scroll_stop_at(uint32_t steps)
+{
+	uint16_t n = ssd1306_scroll.end_column - ssd1306_scroll.start_column + 1;
+	uint8_t* data;
+	uint16_t k;
+	uint8_t m;
+
+	if (ssd1306_work.scroll_skipped)
+	{
+		/* Internal RAM was drawn while scrolling, it holds the picture to show */
+		ssd1306_stop_scroll();
+		return;
+	}
+
+	ssd1306_i2c_command(SSD1306_DEACTIVATE_SCROLL);
+	if (!ssd1306_work.scrolling)
+	{
+		return;
+	}
+	ssd1306_work.scrolling = 0;
+
+	/* Rotate the scrolled columns like GDDRAM, left scroll is a right rotation by n - k */
+	k = steps % n;
+	if (ssd1306_scroll.direction == ssd1306_scroll_dir_left)
+	{
+		k = (n - k) % n;
+	}
+	if ((k == 0) || (ssd1306_screen.buffer == NULL))
+	{
+		return;
+	}
+	for (m = ssd1306_scroll.start_page; m <= ssd1306_scroll.end_page; m++)
+	{
+		data = &ssd1306_screen.buffer[SSD1306_WIDTH * m + ssd1306_scroll.start_column];
+		ssd1306_reverse(data, n);
+		ssd1306_reverse(data, k);
+		ssd1306_reverse(data + k, n - k);
+	}
+}
+
+uint16_t ssd1306_scroll_get_frames(ssd1306_scroll_speed_t speed)
+{
+	return ssd1306_scroll_frames[speed & 0x07];
 }
 
 void ssd1306_stop_scroll(void)
 {
 	ssd1306_i2c_command(SSD1306_DEACTIVATE_SCROLL);
+	if (!ssd1306_work.scrolling)
+	{
+		return;
+	}
+	ssd1306_work.scrolling = 0;
+
+	/* Only the scrolled area of GDDRAM differs from internal RAM */
+	ssd1306_update_area(ssd1306_scroll.start_column, ssd1306_scroll.start_page * 8,
+			ssd1306_scroll.end_column - ssd1306_scroll.start_column + 1,
+			(ssd1306_scroll.end_page - ssd1306_scroll.start_page + 1) * 8);
+}
+
+void ssd1306_scroll_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int16_t dx, int16_t dy)
+{
+	uint64_t rows, kept, fill, column;
+	uint8_t first, last, m;
+	int16_t i, step, src;
+	uint8_t* dst;
+
+	/* Check input parameters, columns are 64-bit words so portrait screens are not supported */
+	if ((ssd1306_screen.width < ssd1306_screen.height) ||
+		(x >= ssd1306_screen.width) || (y >= ssd1306_screen.height) || (w == 0) || (h == 0))
+	{
+		return;
+	}
+
+	/* Check width and height */
+	if ((x + w) > ssd1306_screen.width)
+	{
+		w = ssd1306_screen.width - x;
+	}
+	if ((y + h) > ssd1306_screen.height)
+	{
+		h = ssd1306_screen.height - y;
+	}
+
+	/* Rows of the region, and rows still holding moved pixels, as bits of a 64-bit column */
+	rows = ((h == 64) ? ~(uint64_t)0 : (((uint64_t)1 << h) - 1)) << y;
+	if (ABS(dy) >= h)
+	{
+		kept = 0;
+	}
+	else
+	{
+		kept = (dy >= 0) ? (rows << dy) & rows : (rows >> -dy) & rows;
+	}
+	fill = ssd1306_work.inverted ? rows : 0;  // Black background
+	first = y / 8;
+	last = (y + h - 1) / 8;
+
+	/* Walk against the move, so source columns are read before being overwritten */
+	step = (dx > 0) ? -1 : 1;
+	for (i = (dx > 0) ? (w - 1) : 0; (i >= 0) && (i < w); i += step)
+	{
+		dst = &ssd1306_screen.buffer[x + i];
+		src = i - dx;
+		column = 0;
+
+		if ((src >= 0) && (src < w) && kept)
+		{
+			/* Gather the pages of the source column, then shift across pages at once */
+			for (m = first; m <= last; m++)
+			{
+				column |= (uint64_t)ssd1306_screen.buffer[ssd1306_screen.stride * m + x + src] << (m * 8);
+			}
+			column = ((dy >= 0) ? (column << dy) : (column >> -dy)) & kept;
+			column |= fill & ~kept;
+		}
+		else
+		{
+			column = fill;
+		}
+
+		for (m = first; m <= last; m++)
+		{
+			dst[ssd1306_screen.stride * m] = (dst[ssd1306_screen.stride * m] & ~(uint8_t)(rows >> (m * 8))) | (uint8_t)(column >> (m * 8));
+		}
+	}
+
+	ssd1306_update_area(x, y, w, h);
+}
+
+void ssd1306_set_start_line(uint8_t line)
+{
+	ssd1306_i2c_command(0x40 | (line & 0x3F));
+}
+
+void ssd1306_set_vertical_scroll_area(uint8_t fixed, uint8_t rows)
+{
+	ssd1306_i2c_command(SSD1306_SET_VERTICAL_SCROLL_AREA);
+	ssd1306_i2c_command(fixed);
+	ssd1306_i2c_command(rows);
+}
+
+void ssd1306_set_rotation(ssd1306_rotation_t rotation)
+{
+	/* 90 degrees is the transpose mirrored left to right, 180 degrees both mirrors, 270 degrees mirrored top to bottom */
+	uint8_t segments = ((rotation == ssd1306_rotation_0) || (rotation == ssd1306_rotation_270)) ? 0x01 : 0x00;
+	uint8_t com = ((rotation == ssd1306_rotation_0) || (rotation == ssd1306_rotation_90)) ? 0x08 : 0x00;
+	uint8_t portrait = (rotation == ssd1306_rotation_90) || (rotation == ssd1306_rotation_270);
+
+	ssd1306_i2c_command(SSD1306_SEGREMAP | segments);
+	ssd1306_i2c_command(SSD1306_COMSCANINC | com);
+	ssd1306_work.rotation = rotation;
+
+#if SSD1306_FRAMEBUFFER
+	/* Internal RAM holds the screen as the application sees it */
+	if (portrait != (ssd1306_screen.width < ssd1306_screen.height))
+	{
+		ssd1306_screen.width = portrait ? SSD1306_HEIGHT : SSD1306_WIDTH;
+		ssd1306_screen.height = portrait ? SSD1306_WIDTH : SSD1306_HEIGHT;
+		ssd1306_screen.stride = ssd1306_screen.width;
+		memset(ssd1306_buffer, 0x00, sizeof(ssd1306_buffer));
+
+		if (ssd1306_target.buffer == ssd1306_screen.buffer)
+		{
+			ssd1306_set_canvas(NULL);
+		}
+	}
+#else
+	(void)portrait;
+#endif
+}
+
+ssd1306_rotation_t ssd1306_get_rotation(void)
+{
+	return (ssd1306_rotation_t)ssd1306_work.rotation;
 }
 
 void ssd1306_invert_display (int i)
@@ -221,28 +710,61 @@ void ssd1306_draw_bitmap(int16_t x, int16_t y, const unsigned char* bitmap, int1
     }
 }
 
+void ssd1306_draw_bitmap_rle(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color)
+{
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = !color;
+	}
+
+	/* Set bits are drawn with the opposite color, as in ssd1306_draw_bitmap() */
+	ssd1306_draw_rle(x, y, bitmap, w, h, color ? 0xFF : 0x00, 0);
+}
+
 void ssd1306_toggle_invert(void)
 {
-	uint16_t i;
+	uint16_t i, p;
+	uint8_t* row;
+	uint8_t mask;
 	
 	/* Toggle invert */
 	ssd1306_work.inverted = !ssd1306_work.inverted;
 	
-	/* Do memory toggle */
-	for (i = 0; i < sizeof(ssd1306_buffer); i++)
+	/* Do memory toggle, rows below a view in its last page belong to the parent */
+	for (p = 0; p < ssd1306_work.band_pages; p++)
 	{
-		ssd1306_buffer[i] = ~ssd1306_buffer[i];
+		mask = 0xFF;
+		if (((ssd1306_work.band_first + p) == ((ssd1306_target.height - 1) / 8)) && ((ssd1306_target.height % 8) != 0))
+		{
+			mask >>= 8 - (ssd1306_target.height % 8);
+		}
+
+		row = &ssd1306_target.buffer[p * ssd1306_target.stride];
+		for (i = 0; i < ssd1306_target.width; i++)
+		{
+			row[i] ^= mask;
+		}
 	}
 }
 
 void ssd1306_fill(ssd1306_color_t color)
 {
-	memset(ssd1306_buffer, (color == ssd1306_color_black) ? 0x00 : 0xFF, sizeof(ssd1306_buffer));
+	/* Last page of a view is masked to its height */
+	ssd1306_fill_area(0, 0, ssd1306_target.width, ssd1306_target.height, color);
 }
 
 void ssd1306_draw_pixel(uint16_t x, uint16_t y, ssd1306_color_t color)
 {
-	if ((x >= SSD1306_WIDTH) || (y >= SSD1306_HEIGHT))
+	uint8_t* row;
+
+	if ((x >= ssd1306_target.width) || (y >= ssd1306_target.height))
+	{
+		return;
+	}
+
+	row = ssd1306_target_page(y / 8);
+	if (row == NULL)
 	{
 		return;
 	}
@@ -256,11 +778,11 @@ void ssd1306_draw_pixel(uint16_t x, uint16_t y, ssd1306_color_t color)
 	/* Set color */
 	if (color == ssd1306_color_white)
 	{
-		ssd1306_buffer[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
+		row[x] |= 1 << (y % 8);
 	}
 	else
 	{
-		ssd1306_buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+		row[x] &= ~(1 << (y % 8));
 	}
 }
 
@@ -270,32 +792,69 @@ void ssd1306_goto_xy(uint16_t x, uint16_t y)
 	ssd1306_work.current_y = y;
 }
 
-char ssd1306_putc(char ch, FontDef_t* Font, ssd1306_color_t color)
+void ssd1306_set_text_mode(ssd1306_text_mode_t mode)
 {
-	uint32_t i, b, j;
-	
-	/* Check available space in LCD */
-	if ((SSD1306_WIDTH <= (ssd1306_work.current_x + Font->FontWidth)) || (SSD1306_HEIGHT <= (ssd1306_work.current_y + Font->FontHeight)))
-	{
-		return 0;
-	}
-	
-	/* Go through font */
-	for (i = 0; i < Font->FontHeight; i++)
-	{
-		b = Font->data[(ch - 32) * Font->FontHeight + i];
-		for (j = 0; j < Font->FontWidth; j++)
-		{
-			if ((b << j) & 0x8000)
-			{
-				ssd1306_draw_pixel(ssd1306_work.current_x + j, (ssd1306_work.current_y + i), (ssd1306_color_t) color);
-			}
-			else
+	ssd1306_work.transparent = (mode == ssd1306_text_transparent);
+}
+
+ssd1306_text_mode_t ssd1306_get_text_mode(void)
+{
+	return ssd1306_work.transparent ? ssd1306_text_transparent : ssd1306_text_opaque;
+}
+
+void ssd1306_set_pattern(const ssd1306_pattern_t* pattern, ssd1306_text_mode_t mode)
+{
+	ssd1306_work.pattern = (pattern != NULL) ? pattern->column : NULL;
+	ssd1306_work.pattern_transparent = (mode == ssd1306_text_transparent);
+}
+
+void ssd1306_pattern_gray(ssd1306_pattern_t* pattern, uint8_t level)
+{
+	uint8_t x, y;
+
+	/* A pixel is set when its threshold is below the level, so level n sets n of the 64 pixels */
+	for (x = 0; x < 8; x++)
+	{
+		pattern->column[x] = 0;
+		for (y = 0; y < 8; y++)
+		{
+			if (ssd1306_bayer[y][x] < level)
 			{
-				ssd1306_draw_pixel(ssd1306_work.current_x + j, (ssd1306_work.current_y + i), (ssd1306_color_t)!color);
+				pattern->column[x] |= 1 << y;
 			}
 		}
 	}
+}
+
+char ssd1306_putc(char ch, FontDef_t* Font, ssd1306_color_t color)
+{
+	uint8_t columns[SSD1306_GLYPH_BUFFER_SIZE];
+	
+	/* Check character is part of font and glyph fits the column buffer */
+	if (((uint8_t)ch < FONTS_FIRST_CHAR) || ((uint8_t)ch > FONTS_LAST_CHAR) ||
+		((Font->FontWidth * FONTS_PAGES(Font->FontHeight)) > SSD1306_GLYPH_BUFFER_SIZE))
+	{
+		return 0;
+	}
+	
+	/* Check available space in LCD */
+	if ((ssd1306_target.width <= (ssd1306_work.current_x + Font->FontWidth)) || (ssd1306_target.height <= (ssd1306_work.current_y + Font->FontHeight)))
+	{
+		return 0;
+	}
+	
+	/* Transpose glyph rows into column bytes */
+	ssd1306_transpose_glyph(ch, Font, columns);
+	
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = (ssd1306_color_t)!color;
+	}
+
+	/* Draw whole columns */
+	ssd1306_blit_columns(ssd1306_work.current_x, ssd1306_work.current_y, columns, Font->FontWidth, Font->FontHeight,
+			(color == ssd1306_color_white) ? 0x00 : 0xFF, ssd1306_work.transparent);
 	
 	/* Increase pointer */
 	ssd1306_work.current_x += Font->FontWidth;
@@ -324,26 +883,196 @@ char ssd1306_puts(char* str, FontDef_t* Font, ssd1306_color_t color)
 	return *str;
 }
  
+char ssd1306_putc_scaled(char ch, FontDef_t* Font, uint8_t scale, ssd1306_color_t color)
+{
+	uint8_t columns[SSD1306_GLYPH_BUFFER_SIZE];
+	uint32_t value, mask;
+	uint16_t p, i, rows;
+	uint8_t k, dx, invert;
+	int16_t x, y;
+
+	/* Unscaled glyphs need no expansion */
+	if (scale == 1)
+	{
+		return ssd1306_putc(ch, Font, color);
+	}
+
+	/* Check character is part of font, scale is supported and glyph fits the column buffer */
+	if (((uint8_t)ch < FONTS_FIRST_CHAR) || ((uint8_t)ch > FONTS_LAST_CHAR) || (scale < 2) || (scale > SSD1306_SCALE_MAX) ||
+		((Font->FontWidth * FONTS_PAGES(Font->FontHeight)) > SSD1306_GLYPH_BUFFER_SIZE))
+	{
+		return 0;
+	}
+
+	/* Check available space in LCD */
+	if ((ssd1306_target.width < (ssd1306_work.current_x + Font->FontWidth * scale)) ||
+		(ssd1306_target.height < (ssd1306_work.current_y + Font->FontHeight * scale)))
+	{
+		return 0;
+	}
+
+	/* Transpose glyph rows into column bytes */
+	ssd1306_transpose_glyph(ch, Font, columns);
+
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = (ssd1306_color_t)!color;
+	}
+	invert = (color == ssd1306_color_white) ? 0x00 : 0xFF;
+
+	for (p = 0; p < FONTS_PAGES(Font->FontHeight); p++)
+	{
+		/* Last page may hold less than 8 rows */
+		rows = Font->FontHeight - p * 8;
+		mask = ssd1306_expand_byte((rows >= 8) ? 0xFF : (0xFF >> (8 - rows)), scale);
+
+		for (i = 0; i < Font->FontWidth; i++)
+		{
+			/* One source byte becomes scale whole bytes, each written to scale columns */
+			value = ssd1306_expand_byte(columns[p * Font->FontWidth + i], scale);
+			x = ssd1306_work.current_x + i * scale;
+			y = ssd1306_work.current_y + p * 8 * scale;
+
+			for (k = 0; k < scale; k++, y += 8)
+			{
+				for (dx = 0; dx < scale; dx++)
+				{
+					ssd1306_write_glyph(x + dx, y, value >> (k * 8), mask >> (k * 8), invert, ssd1306_work.transparent);
+				}
+			}
+		}
+	}
+
+	/* Increase pointer */
+	ssd1306_work.current_x += Font->FontWidth * scale;
+
+	/* Return character written */
+	return ch;
+}
+
+char ssd1306_puts_scaled(char* str, FontDef_t* Font, uint8_t scale, ssd1306_color_t color)
+{
+	/* Write characters */
+	while (*str)
+	{
+		/* Write character by character */
+		if (ssd1306_putc_scaled(*str, Font, scale, color) != *str)
+		{
+			/* Return error */
+			return *str;
+		}
+
+		/* Increase string pointer */
+		str++;
+	}
+
+	/* Everything OK, zero should be returned */
+	return *str;
+}
+
+void ssd1306_draw_columns(int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, ssd1306_color_t color)
+{
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = (ssd1306_color_t)!color;
+	}
+
+	/* Clear bits are drawn as background, so black text is the inverted data */
+	ssd1306_blit_columns(x, y, data, w, h, (color == ssd1306_color_white) ? 0x00 : 0xFF, ssd1306_work.transparent);
+}
+
+uint16_t ssd1306_puts_bitmap(uint8_t* data, uint16_t w, uint16_t h, const char* str, const FontPageDef_t* Font)
+{
+	ssd1306_canvas_t target = ssd1306_target;
+	ssd1306_work_t work = ssd1306_work;
+	uint16_t width;
+
+	memset(data, 0, w * FONTS_PAGES(h));
+
+	/* Draw set bits only, into the bitmap */
+	ssd1306_canvas_init(&ssd1306_target, data, w, h);
+	ssd1306_work.band_first = 0;
+	ssd1306_work.band_pages = FONTS_PAGES(h);
+	ssd1306_work.current_x = 0;
+	ssd1306_work.current_y = 0;
+	ssd1306_work.inverted = 0;
+	ssd1306_work.transparent = 1;
+
+	ssd1306_puts_page(str, Font, ssd1306_color_white);
+	width = ssd1306_work.current_x;
+
+	/* Back to the previous canvas */
+	ssd1306_target = target;
+	ssd1306_work = work;
+
+	return width;
+}
+
+char ssd1306_putc_page(char ch, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	/* Bytes above 0x7F are Latin-1, which matches the first 256 code points */
+	return (ssd1306_putc_unicode((uint8_t)ch, Font, color) != 0) ? ch : 0;
+}
+
+uint16_t ssd1306_putc_unicode(uint16_t ch, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	return ssd1306_put_glyph(ch, Font, color, 1);
+}
+
+char ssd1306_puts_page(const char* str, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	const char* next = str;
+	uint8_t background = 1;
+	uint16_t ch;
+
+	/* Proportional glyphs only draw their inked box, so the background of the whole string is filled once */
+	if ((Font->Glyphs != NULL) && !ssd1306_work.transparent)
+	{
+		ssd1306_fill_area(ssd1306_work.current_x, ssd1306_work.current_y, FONTS_GetStringWidth(str, Font), Font->FontHeight,
+				ssd1306_work.inverted ? color : (ssd1306_color_t)!color);
+		background = 0;
+	}
+
+	/* Write characters */
+	while ((ch = FONTS_DecodeUTF8(&next)) != 0)
+	{
+		/* Write character by character */
+		if (ssd1306_put_glyph(ch, Font, color, background) != ch)
+		{
+			/* Return error */
+			return *str;
+		}
+
+		/* Increase string pointer */
+		str = next;
+	}
+
+	/* Everything OK, zero should be returned */
+	return *str;
+}
+
 void ssd1306_draw_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ssd1306_color_t c)
 {
 	int16_t dx, dy, sx, sy, err, e2, i, tmp; 
 	
 	/* Check for overflow */
-	if (x0 >= SSD1306_WIDTH)
+	if (x0 >= ssd1306_target.width)
 	{
-		x0 = SSD1306_WIDTH - 1;
+		x0 = ssd1306_target.width - 1;
 	}
-	if (x1 >= SSD1306_WIDTH)
+	if (x1 >= ssd1306_target.width)
 	{
-		x1 = SSD1306_WIDTH - 1;
+		x1 = ssd1306_target.width - 1;
 	}
-	if (y0 >= SSD1306_HEIGHT)
+	if (y0 >= ssd1306_target.height)
 	{
-		y0 = SSD1306_HEIGHT - 1;
+		y0 = ssd1306_target.height - 1;
 	}
-	if (y1 >= SSD1306_HEIGHT)
+	if (y1 >= ssd1306_target.height)
 	{
-		y1 = SSD1306_HEIGHT - 1;
+		y1 = ssd1306_target.height - 1;
 	}
 	
 	dx = (x0 < x1) ? (x1 - x0) : (x0 - x1); 
@@ -428,20 +1157,20 @@ void ssd1306_draw_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ssd13
 void ssd1306_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c)
 {
 	/* Check input parameters */
-	if ((x >= SSD1306_WIDTH) || (y >= SSD1306_HEIGHT))
+	if ((x >= ssd1306_target.width) || (y >= ssd1306_target.height))
 	{
 		/* Return error */
 		return;
 	}
 	
 	/* Check width and height */
-	if ((x + w) >= SSD1306_WIDTH)
+	if ((x + w) >= ssd1306_target.width)
 	{
-		w = SSD1306_WIDTH - x;
+		w = ssd1306_target.width - x;
 	}
-	if ((y + h) >= SSD1306_HEIGHT)
+	if ((y + h) >= ssd1306_target.height)
 	{
-		h = SSD1306_HEIGHT - y;
+		h = ssd1306_target.height - y;
 	}
 	
 	/* Draw 4 lines */
@@ -453,31 +1182,25 @@ void ssd1306_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1
 
 void ssd1306_draw_filled_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c)
 {
-	uint8_t i;
-	
 	/* Check input parameters */
-	if ((x >= SSD1306_WIDTH) || (y >= SSD1306_HEIGHT))
+	if ((x >= ssd1306_target.width) || (y >= ssd1306_target.height))
 	{
 		/* Return error */
 		return;
 	}
 	
 	/* Check width and height */
-	if ((x + w) >= SSD1306_WIDTH)
+	if ((x + w) >= ssd1306_target.width)
 	{
-		w = SSD1306_WIDTH - x;
+		w = ssd1306_target.width - x;
 	}
-	if ((y + h) >= SSD1306_HEIGHT)
+	if ((y + h) >= ssd1306_target.height)
 	{
-		h = SSD1306_HEIGHT - y;
+		h = ssd1306_target.height - y;
 	}
 	
-	/* Draw lines */
-	for (i = 0; i <= h; i++)
-	{
-		/* Draw lines */
-		ssd1306_draw_line(x, y + i, x + w, y + i, c);
-	}
+	/* Byte masks per page, corners included like the outline */
+	ssd1306_fill_pattern(x, y, w + 1, h + 1, c);
 }
 
 void ssd1306_draw_triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, ssd1306_color_t color)
@@ -601,11 +1324,10 @@ void ssd1306_draw_filled_circle(int16_t x0, int16_t y0, int16_t r, ssd1306_color
 	int16_t x = 0;
 	int16_t y = r;
 
-    ssd1306_draw_pixel(x0, y0 + r, c);
-    ssd1306_draw_pixel(x0, y0 - r, c);
-    ssd1306_draw_pixel(x0 + r, y0, c);
-    ssd1306_draw_pixel(x0 - r, y0, c);
-    ssd1306_draw_line(x0 - r, y0, x0 + r, y0, c);
+    /* Horizontal spans, each one a run of byte masks */
+    ssd1306_fill_pattern(x0, y0 + r, 1, 1, c);
+    ssd1306_fill_pattern(x0, y0 - r, 1, 1, c);
+    ssd1306_fill_pattern(x0 - r, y0, 2 * r + 1, 1, c);
 
     while (x < y)
     {
@@ -619,11 +1341,11 @@ void ssd1306_draw_filled_circle(int16_t x0, int16_t y0, int16_t r, ssd1306_color
         ddF_x += 2;
         f += ddF_x;
 
-        ssd1306_draw_line(x0 - x, y0 + y, x0 + x, y0 + y, c);
-        ssd1306_draw_line(x0 + x, y0 - y, x0 - x, y0 - y, c);
+        ssd1306_fill_pattern(x0 - x, y0 + y, 2 * x + 1, 1, c);
+        ssd1306_fill_pattern(x0 - x, y0 - y, 2 * x + 1, 1, c);
 
-        ssd1306_draw_line(x0 + y, y0 + x, x0 - y, y0 + x, c);
-        ssd1306_draw_line(x0 + y, y0 - x, x0 - y, y0 - x, c);
+        ssd1306_fill_pattern(x0 - y, y0 + x, 2 * y + 1, 1, c);
+        ssd1306_fill_pattern(x0 - y, y0 - x, 2 * y + 1, 1, c);
     }
 }
 
@@ -647,3 +1369,533 @@ void ssd1306_off(void)
 	ssd1306_i2c_command(0xAE);
 }
 
+static void ssd1306_write_column(int16_t x, int16_t y, uint8_t bits, uint8_t mask)
+{
+	uint8_t shift;
+	uint8_t* dst;
+
+	/* Check input parameters */
+	if ((x < 0) || (x >= ssd1306_target.width) || (y <= -8) || (y >= ssd1306_target.height))
+	{
+		return;
+	}
+
+	/* Clip rows above the screen */
+	if (y < 0)
+	{
+		bits >>= -y;
+		mask >>= -y;
+		y = 0;
+	}
+
+	shift = y % 8;
+
+	/* Lower part goes to the first page */
+	dst = ssd1306_target_page(y / 8);
+	if (dst != NULL)
+	{
+		dst[x] = (dst[x] & ~(mask << shift)) | (bits << shift);
+	}
+
+	/* Upper part spills into the next page */
+	if ((shift != 0) && ((y / 8) < (FONTS_PAGES(ssd1306_target.height) - 1)))
+	{
+		dst = ssd1306_target_page(y / 8 + 1);
+		if (dst != NULL)
+		{
+			dst[x] = (dst[x] & ~(mask >> (8 - shift))) | (bits >> (8 - shift));
+		}
+	}
+}
+
+static void ssd1306_transpose_glyph(char ch, FontDef_t* Font, uint8_t* columns)
+{
+	uint32_t i, b, j;
+
+	memset(columns, 0, Font->FontWidth * FONTS_PAGES(Font->FontHeight));
+	for (i = 0; i < Font->FontHeight; i++)
+	{
+		b = Font->data[((uint8_t)ch - FONTS_FIRST_CHAR) * Font->FontHeight + i];
+		for (j = 0; b != 0; j++, b = (b << 1) & 0xFFFF)
+		{
+			if (b & 0x8000)
+			{
+				columns[(i / 8) * Font->FontWidth + j] |= 1 << (i % 8);
+			}
+		}
+	}
+}
+
+static uint32_t ssd1306_expand_byte(uint8_t value, uint8_t scale)
+{
+	const uint16_t* table = ssd1306_expand[scale - 2];
+
+	return table[value & 0x0F] | ((uint32_t)table[value >> 4] << (scale * 4));
+}
+
+static void ssd1306_write_glyph(int16_t x, int16_t y, uint8_t value, uint8_t mask, uint8_t invert, uint8_t transparent)
+{
+	if (!transparent)
+	{
+		/* Clear bits are painted with the background color */
+		ssd1306_write_column(x, y, (value ^ invert) & mask, mask);
+	}
+	else if ((value & mask) != 0)
+	{
+		/* Only set bits are touched: OR for white, AND-NOT for black */
+		mask &= value;
+		ssd1306_write_column(x, y, mask & ~invert, mask);
+	}
+}
+
+static void ssd1306_fill_area(int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_color_t color)
+{
+	uint8_t value = (color == ssd1306_color_white) ? 0xFF : 0x00;
+	uint8_t mask;
+	uint8_t* dst;
+	int16_t i;
+
+	/* Clip to screen */
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if ((x + w) > ssd1306_target.width)
+	{
+		w = ssd1306_target.width - x;
+	}
+	if ((y + h) > ssd1306_target.height)
+	{
+		h = ssd1306_target.height - y;
+	}
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
+	/* One byte mask per page, whole pages are plain stores */
+	while (h > 0)
+	{
+		mask = 0xFF << (y % 8);
+		if (((y % 8) + h) < 8)
+		{
+			mask &= 0xFF >> (8 - ((y % 8) + h));
+		}
+
+		dst = ssd1306_target_page(y / 8);
+		if (dst == NULL)
+		{
+			/* Page outside the band in memory */
+		}
+		else if (mask == 0xFF)
+		{
+			memset(&dst[x], value, w);
+		}
+		else
+		{
+			dst += x;
+			for (i = 0; i < w; i++)
+			{
+				dst[i] = (dst[i] & ~mask) | (value & mask);
+			}
+		}
+
+		h -= 8 - (y % 8);
+		y += 8 - (y % 8);
+	}
+}
+
+static void ssd1306_fill_pattern(int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_color_t color)
+{
+	const uint8_t* pattern = ssd1306_work.pattern;
+	uint8_t keep[8], set[8];
+	uint64_t keep_word, set_word, word;
+	uint8_t bits, mask;
+	uint8_t* dst;
+	int16_t i, n;
+
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = (ssd1306_color_t)!color;
+	}
+
+	if (pattern == NULL)
+	{
+		ssd1306_fill_area(x, y, w, h, color);
+		return;
+	}
+
+	/* Clip to screen */
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if ((x + w) > ssd1306_target.width)
+	{
+		w = ssd1306_target.width - x;
+	}
+	if ((y + h) > ssd1306_target.height)
+	{
+		h = ssd1306_target.height - y;
+	}
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
+	/* The pattern is one page high, so a page is 8 keep/set byte pairs repeated along the row */
+	while (h > 0)
+	{
+		mask = 0xFF << (y % 8);
+		if (((y % 8) + h) < 8)
+		{
+			mask &= 0xFF >> (8 - ((y % 8) + h));
+		}
+
+		for (i = 0; i < MIN(w, 8); i++)
+		{
+			bits = pattern[(x + i) & 7];
+			if (ssd1306_work.pattern_transparent)
+			{
+				/* Set pattern bits only: OR for white, AND-NOT for black */
+				keep[i] = (color == ssd1306_color_white) ? 0xFF : ~(bits & mask);
+				set[i] = (color == ssd1306_color_white) ? (bits & mask) : 0x00;
+			}
+			else
+			{
+				/* Clear pattern bits get the opposite color */
+				keep[i] = ~mask;
+				set[i] = ((color == ssd1306_color_white) ? bits : ~bits) & mask;
+			}
+		}
+
+		dst = ssd1306_target_page(y / 8);
+		if (dst == NULL)
+		{
+			/* Page outside the band in memory */
+		}
+		else if (!ssd1306_work.pattern_transparent && (mask == 0xFF))
+		{
+			/* Whole opaque page: one tile, then copies doubling in size, like a memset */
+			dst += x;
+			n = MIN(w, 8);
+			memcpy(dst, set, n);
+			for (; n < w; n *= 2)
+			{
+				memcpy(&dst[n], dst, MIN(n, w - n));
+			}
+		}
+		else
+		{
+			/* Eight columns per step as one 64-bit word, the rest byte by byte */
+			dst += x;
+			i = 0;
+			if (w >= 8)
+			{
+				memcpy(&keep_word, keep, 8);
+				memcpy(&set_word, set, 8);
+				for (; (i + 8) <= w; i += 8)
+				{
+					memcpy(&word, &dst[i], 8);
+					word = (word & keep_word) | set_word;
+					memcpy(&dst[i], &word, 8);
+				}
+			}
+			for (; i < w; i++)
+			{
+				dst[i] = (dst[i] & keep[i & 7]) | set[i & 7];
+			}
+		}
+
+		h -= 8 - (y % 8);
+		y += 8 - (y % 8);
+	}
+}
+
+static void ssd1306_blit_columns(int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, uint8_t invert, uint8_t transparent)
+{
+	uint16_t p, i, rows;
+	uint8_t mask;
+
+	for (p = 0; p < FONTS_PAGES(h); p++, y += 8, data += w)
+	{
+		/* Last page may hold less than 8 rows */
+		rows = h - p * 8;
+		mask = (rows >= 8) ? 0xFF : (0xFF >> (8 - rows));
+
+		for (i = 0; i < w; i++)
+		{
+			ssd1306_write_glyph(x + i, y, data[i], mask, invert, transparent);
+		}
+	}
+}
+
+static uint16_t ssd1306_put_glyph(uint16_t ch, const FontPageDef_t* Font, ssd1306_color_t color, uint8_t background)
+{
+	int32_t glyph = FONTS_GetGlyphIndex(Font, ch);
+	const FontGlyphDef_t* metrics;
+	uint8_t advance, invert;
+	int16_t x, y;
+
+	/* Check character is part of font */
+	if (glyph < 0)
+	{
+		return 0;
+	}
+
+	/* Check available space in LCD, glyphs may end on the last column and row */
+	advance = FONTS_GetGlyphAdvance(Font, glyph);
+	if ((ssd1306_target.width < (ssd1306_work.current_x + advance)) || (ssd1306_target.height < (ssd1306_work.current_y + Font->FontHeight)))
+	{
+		return 0;
+	}
+
+	/* Check if pixels are inverted */
+	if (ssd1306_work.inverted)
+	{
+		color = (ssd1306_color_t)!color;
+	}
+
+	/* Clear bits are drawn as background, so black text is the inverted data */
+	invert = (color == ssd1306_color_white) ? 0x00 : 0xFF;
+	x = ssd1306_work.current_x;
+	y = ssd1306_work.current_y;
+
+	if (Font->Glyphs != NULL)
+	{
+		/* Background of the cell, unless the caller already filled it */
+		if (background && !ssd1306_work.transparent)
+		{
+			ssd1306_fill_area(x, y, advance, Font->FontHeight, (ssd1306_color_t)!color);
+		}
+
+		/* Inked box only, blank rows and columns are skipped */
+		metrics = &Font->Glyphs[glyph];
+		if (metrics->Width != 0)
+		{
+			if (Font->Format == FONTS_FORMAT_RLE)
+			{
+				ssd1306_draw_rle(x + metrics->Left, y + metrics->Top, &Font->data[metrics->Offset],
+						metrics->Width, metrics->Height, invert, 1);
+			}
+			else
+			{
+				ssd1306_blit_columns(x + metrics->Left, y + metrics->Top, &Font->data[metrics->Offset],
+						metrics->Width, metrics->Height, invert, 1);
+			}
+		}
+	}
+	else if (Font->Format == FONTS_FORMAT_PACKED)
+	{
+		/* Decode straight into the buffer */
+		ssd1306_draw_packed(x, y, Font, &Font->data[Font->Index[glyph]], invert, ssd1306_work.transparent);
+	}
+	else if (Font->Format == FONTS_FORMAT_RLE)
+	{
+		ssd1306_draw_rle(x, y, &Font->data[Font->Index[glyph]], Font->FontWidth, Font->FontHeight, invert, ssd1306_work.transparent);
+	}
+	else
+	{
+		/* Draw whole columns */
+		ssd1306_blit_columns(x, y, &Font->data[glyph * Font->FontWidth * FONTS_PAGES(Font->FontHeight)],
+				Font->FontWidth, Font->FontHeight, invert, ssd1306_work.transparent);
+	}
+
+	/* Increase pointer */
+	ssd1306_work.current_x += advance;
+
+	/* Return character written */
+	return ch;
+}
+
+static void ssd1306_draw_packed(int16_t x, int16_t y, const FontPageDef_t* Font, const uint8_t* glyph, uint8_t invert, uint8_t transparent)
+{
+	uint8_t top = glyph[0];
+	uint8_t rows = glyph[1];
+	uint8_t left = glyph[2] >> 4;
+	uint8_t right = left + (glyph[2] & 0x0F);
+	uint32_t row_mask = (rows >= 32) ? 0xFFFFFFFF : ((1UL << rows) - 1);
+	const uint8_t* src = &glyph[3];
+	uint64_t bits = 0;
+	uint8_t count = 0;
+	uint32_t column;
+	uint8_t i, p, mask;
+
+	for (i = 0; i < Font->FontWidth; i++)
+	{
+		column = 0;
+
+		/* Columns outside the inked box are blank */
+		if ((rows != 0) && (i >= left) && (i <= right))
+		{
+			/* Refill bit reservoir */
+			while (count < rows)
+			{
+				bits |= (uint64_t)*src++ << count;
+				count += 8;
+			}
+
+			column = ((uint32_t)bits & row_mask) << top;
+			bits >>= rows;
+			count -= rows;
+		}
+
+		/* Write whole column bytes */
+		for (p = 0; p < FONTS_PAGES(Font->FontHeight); p++)
+		{
+			mask = ((Font->FontHeight - p * 8) >= 8) ? 0xFF : (0xFF >> (8 - (Font->FontHeight - p * 8)));
+			ssd1306_write_glyph(x + i, y + p * 8, column >> (p * 8), mask, invert, transparent);
+		}
+	}
+}
+
+static void ssd1306_draw_rle(int16_t x, int16_t y, const uint8_t* src, uint16_t w, uint16_t h, uint8_t invert, uint8_t transparent)
+{
+	uint16_t i = 0, p = 0;
+	uint8_t mask = (h >= 8) ? 0xFF : (0xFF >> (8 - h));
+	uint8_t count, value = 0, literal;
+
+	while (p < FONTS_PAGES(h))
+	{
+		/* Read run header */
+		count = *src++;
+		literal = !(count & 0x80);
+		count = literal ? (count + 1) : ((count & 0x7F) + 2);
+		if (!literal)
+		{
+			value = *src++;
+		}
+
+		/* Write run straight into the buffer */
+		while (count--)
+		{
+			if (literal)
+			{
+				value = *src++;
+			}
+
+			ssd1306_write_glyph(x + i, y + p * 8, value, mask, invert, transparent);
+
+			if (++i == w)
+			{
+				/* Next page, last one may hold less than 8 rows */
+				i = 0;
+				p++;
+				mask = ((h - p * 8) >= 8) ? 0xFF : (0xFF >> (8 - (h - p * 8)));
+				if (p == FONTS_PAGES(h))
+				{
+					break;
+				}
+			}
+		}
+	}
+}
+
+static uint8_t ssd1306_page_scrolling(uint8_t page)
+{
+	/* GDDRAM of scrolled pages must not be written until scrolling stops */
+	if (ssd1306_work.scrolling && (page >= ssd1306_scroll.start_page) && (page <= ssd1306_scroll.end_page))
+	{
+		ssd1306_work.scroll_skipped = 1;
+		return 1;
+	}
+	return 0;
+}
+
+static void ssd1306_reverse(uint8_t* data, uint16_t n)
+{
+	uint8_t* last = data + n - 1;
+	uint8_t tmp;
+
+	while (data < last)
+	{
+		tmp = *data;
+		*data++ = *last;
+		*last-- = tmp;
+	}
+}
+
+static void ssd1306_select_target(const ssd1306_canvas_t* canvas, uint16_t first, uint16_t pages)
+{
+	ssd1306_target = *canvas;
+	ssd1306_work.band_first = first;
+	ssd1306_work.band_pages = pages;
+}
+
+static uint8_t* ssd1306_target_page(uint16_t page)
+{
+	/* Pages outside the band held in memory are clipped */
+	if ((page < ssd1306_work.band_first) || (page >= (ssd1306_work.band_first + ssd1306_work.band_pages)))
+	{
+		return NULL;
+	}
+	return &ssd1306_target.buffer[(page - ssd1306_work.band_first) * ssd1306_target.stride];
+}
+
+static void ssd1306_update_portrait(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	uint8_t row[SSD1306_WIDTH];
+	uint8_t m, q, first, last;
+
+	/* Columns of internal RAM become LCD pages, its pages become blocks of 8 LCD columns */
+	first = y / 8;
+	last = (y + h - 1) / 8;
+
+	for (m = x / 8; m <= (x + w - 1) / 8; m++)
+	{
+		if (ssd1306_page_scrolling(m))
+		{
+			continue;
+		}
+
+		for (q = first; q <= last; q++)
+		{
+			ssd1306_transpose(&ssd1306_screen.buffer[q * ssd1306_screen.stride + m * 8], &row[(q - first) * 8]);
+		}
+
+		ssd1306_i2c_command(0xB0 + m);
+		ssd1306_i2c_command(0x00 | ((first * 8) & 0x0F));
+		ssd1306_i2c_command(0x10 | ((first * 8) >> 4));
+
+		/* Write multi data */
+		ssd1306_i2c_write_multi(0x40, row, (last - first + 1) * 8);
+	}
+}
+
+static void ssd1306_transpose(const uint8_t* in, uint8_t* out)
+{
+	uint64_t x = 0, t;
+	uint8_t i;
+
+	/* Bit j of byte i becomes bit i of byte j */
+	for (i = 0; i < 8; i++)
+	{
+		x |= (uint64_t)in[i] << (i * 8);
+	}
+
+	/* Swap the off-diagonal 1x1, then 2x2, then 4x4 blocks */
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+	x ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+	x ^= t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+	x ^= t ^ (t << 28);
+
+	for (i = 0; i < 8; i++)
+	{
+		out[i] = (uint8_t)(x >> (i * 8));
+	}
+}
@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_columns.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_columns.h"
+#include "ssd1306_hal.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_COLUMNS_PAGES       (SSD1306_HEIGHT / 8)
+
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define ABS(x) ((x) > 0 ? (x) : -(x))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t ssd1306_columns_rows(int16_t y, int16_t h);
+static uint64_t ssd1306_columns_reverse(uint64_t value);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_columns_fill(ssd1306_columns_t* cols, ssd1306_color_t color)
+{
+	memset(cols->column, (color == ssd1306_color_white) ? 0xFF : 0x00, sizeof(cols->column));
+}
+
+void ssd1306_columns_pixel(ssd1306_columns_t* cols, uint16_t x, uint16_t y, ssd1306_color_t color)
+{
+	if ((x >= SSD1306_WIDTH) || (y >= SSD1306_HEIGHT))
+	{
+		return;
+	}
+
+	if (color == ssd1306_color_white)
+	{
+		cols->column[x] |= (uint64_t)1 << y;
+	}
+	else
+	{
+		cols->column[x] &= ~((uint64_t)1 << y);
+	}
+}
+
+void ssd1306_columns_span(ssd1306_columns_t* cols, uint16_t x, int16_t y0, int16_t y1, ssd1306_color_t color)
+{
+	uint64_t mask;
+
+	if (x >= SSD1306_WIDTH)
+	{
+		return;
+	}
+
+	mask = ssd1306_columns_rows(MIN(y0, y1), ABS(y1 - y0) + 1);
+	if (color == ssd1306_color_white)
+	{
+		cols->column[x] |= mask;
+	}
+	else
+	{
+		cols->column[x] &= ~mask;
+	}
+}
+
+void ssd1306_columns_scroll(ssd1306_columns_t* cols, uint16_t x, uint16_t w, int16_t dx, int16_t dy, ssd1306_color_t background)
+{
+	uint64_t fill = (background == ssd1306_color_white) ? ~(uint64_t)0 : 0;
+	uint64_t* data;
+	uint16_t i;
+
+	/* Check input parameters */
+	if (x >= SSD1306_WIDTH)
+	{
+		return;
+	}
+	w = MIN(w, SSD1306_WIDTH - x);
+	data = &cols->column[x];
+
+	/* Moved out of the region, only background is left */
+	if ((dx >= (int16_t)w) || (-dx >= (int16_t)w))
+	{
+		dx = 0;
+		dy = SSD1306_HEIGHT;
+	}
+
+	/* Horizontal: whole columns move */
+	if (dx > 0)
+	{
+		memmove(&data[dx], data, (w - dx) * sizeof(uint64_t));
+		for (i = 0; i < dx; i++)
+		{
+			data[i] = fill;
+		}
+	}
+	else if (dx < 0)
+	{
+		memmove(data, &data[-dx], (w + dx) * sizeof(uint64_t));
+		for (i = w + dx; i < w; i++)
+		{
+			data[i] = fill;
+		}
+	}
+
+	/* Vertical: one shift per column, bit 0 is the top row */
+	if ((dy >= SSD1306_HEIGHT) || (-dy >= SSD1306_HEIGHT))
+	{
+		for (i = 0; i < w; i++)
+		{
+			data[i] = fill;
+		}
+	}
+	else if (dy > 0)
+	{
+		for (i = 0; i < w; i++)
+		{
+			data[i] = (data[i] << dy) | (fill >> (SSD1306_HEIGHT - dy));
+		}
+	}
+	else if (dy < 0)
+	{
+		for (i = 0; i < w; i++)
+		{
+			data[i] = (data[i] >> -dy) | (fill << (SSD1306_HEIGHT + dy));
+		}
+	}
+}
+
+void ssd1306_columns_flip(ssd1306_columns_t* cols, uint16_t x, uint16_t w)
+{
+	uint16_t i;
+
+	for (i = x; (i < (uint32_t)x + w) && (i < SSD1306_WIDTH); i++)
+	{
+		cols->column[i] = ssd1306_columns_reverse(cols->column[i]);
+	}
+}
+
+void ssd1306_columns_blit(ssd1306_columns_t* cols, int16_t x, int16_t y, const ssd1306_canvas_t* canvas)
+{
+	uint64_t column, mask;
+	int16_t i, p;
+
+	/* Rows covered by the canvas */
+	mask = ssd1306_columns_rows(y, canvas->height);
+	if ((mask == 0) || (canvas->height > SSD1306_HEIGHT))
+	{
+		return;
+	}
+
+	for (i = MAX(0, -x); (i < canvas->width) && ((x + i) < SSD1306_WIDTH); i++)
+	{
+		/* Gather the pages of a canvas column into one word, then move it to row y */
+		column = 0;
+		for (p = 0; p < FONTS_PAGES(canvas->height); p++)
+		{
+			column |= (uint64_t)canvas->buffer[p * canvas->stride + i] << (p * 8);
+		}
+		column = (y >= 0) ? (column << y) : (column >> -y);
+
+		cols->column[x + i] = (cols->column[x + i] & ~mask) | (column & mask);
+	}
+}
+
+void ssd1306_columns_store(const ssd1306_columns_t* cols, ssd1306_canvas_t* canvas)
+{
+	uint8_t* row;
+	uint16_t x;
+	uint8_t p;
+
+	for (p = 0; p < SSD1306_COLUMNS_PAGES; p++)
+	{
+		row = &canvas->buffer[p * canvas->stride];
+		for (x = 0; x < SSD1306_WIDTH; x++)
+		{
+			row[x] = (uint8_t)(cols->column[x] >> (p * 8));
+		}
+	}
+}
+
+void ssd1306_columns_update(const ssd1306_columns_t* cols, uint16_t x, uint16_t w)
+{
+	uint8_t chunk[SSD1306_COLUMNS_CHUNK];
+	uint16_t i, n, k;
+	uint8_t p;
+
+	/* Check input parameters, columns are sent as landscape pages so portrait screens are left alone */
+	if ((ssd1306_get_screen()->width < ssd1306_get_screen()->height) || (x >= SSD1306_WIDTH) || (w == 0))
+	{
+		return;
+	}
+	w = MIN(w, SSD1306_WIDTH - x);
+
+	for (p = 0; p < SSD1306_COLUMNS_PAGES; p++)
+	{
+		ssd1306_i2c_command(0xB0 + p);
+		ssd1306_i2c_command(0x00 | (x & 0x0F));
+		ssd1306_i2c_command(0x10 | (x >> 4));
+
+		/* Page bytes are cut out of the columns in small chunks, the column address advances by itself */
+		for (i = 0; i < w; i += n)
+		{
+			n = MIN(w - i, SSD1306_COLUMNS_CHUNK);
+			for (k = 0; k < n; k++)
+			{
+				chunk[k] = (uint8_t)(cols->column[x + i + k] >> (p * 8));
+			}
+			ssd1306_i2c_write_multi(0x40, chunk, n);
+		}
+	}
+}
+
+static uint64_t ssd1306_columns_rows(int16_t y, int16_t h)
+{
+	/* Bits y to y + h - 1, clipped to the screen */
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	h = MIN(h, SSD1306_HEIGHT - y);
+	if (h <= 0)
+	{
+		return 0;
+	}
+
+	return (~(uint64_t)0 >> (SSD1306_HEIGHT - h)) << y;
+}
+
+static uint64_t ssd1306_columns_reverse(uint64_t value)
+{
+	/* Swap neighbour bits, then pairs, nibbles, bytes, half words and words */
+	value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+	value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+	value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+	value = ((value >> 8) & 0x00FF00FF00FF00FFULL) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+	value = ((value >> 16) & 0x0000FFFF0000FFFFULL) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+
+	return (value >> 32) | (value << 32);
+}
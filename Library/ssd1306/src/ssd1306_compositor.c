@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_compositor.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_compositor.h"
+#include "ssd1306_damage.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_compositor_init(ssd1306_compositor_t* comp)
+{
+	comp->count = 0;
+	comp->damaged = 0;
+}
+
+void ssd1306_layer_init(ssd1306_layer_t* layer, uint8_t* buffer, const uint8_t* mask, uint16_t w, uint16_t h)
+{
+	ssd1306_canvas_init(&layer->canvas, buffer, w, h);
+	layer->mask = mask;
+	layer->x = 0;
+	layer->y = 0;
+	layer->visible = 1;
+}
+
+uint8_t ssd1306_compositor_add(ssd1306_compositor_t* comp, ssd1306_layer_t* layer)
+{
+	if (comp->count >= SSD1306_COMPOSITOR_LAYERS)
+	{
+		return 0;
+	}
+
+	comp->layers[comp->count++] = layer;
+	if (layer->visible)
+	{
+		ssd1306_layer_damage(comp, layer, 0, 0, layer->canvas.width, layer->canvas.height);
+	}
+
+	return 1;
+}
+
+void ssd1306_compositor_damage(ssd1306_compositor_t* comp, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	ssd1306_damage_add(comp->damage, &comp->damaged, SSD1306_COMPOSITOR_DAMAGE, x, y, w, h);
+}
+
+void ssd1306_layer_damage(ssd1306_compositor_t* comp, const ssd1306_layer_t* layer, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	/* Clip to layer */
+	w = MIN(x + w, (int16_t)layer->canvas.width) - MAX(x, 0);
+	h = MIN(y + h, (int16_t)layer->canvas.height) - MAX(y, 0);
+	x = MAX(x, 0);
+	y = MAX(y, 0);
+
+	ssd1306_compositor_damage(comp, layer->x + x, layer->y + y, w, h);
+}
+
+void ssd1306_layer_move(ssd1306_compositor_t* comp, ssd1306_layer_t* layer, int16_t x, int16_t y)
+{
+	if ((layer->x == x) && (layer->y == y))
+	{
+		return;
+	}
+
+	if (layer->visible)
+	{
+		ssd1306_compositor_damage(comp, layer->x, layer->y, layer->canvas.width, layer->canvas.height);
+		ssd1306_compositor_damage(comp, x, y, layer->canvas.width, layer->canvas.height);
+	}
+	layer->x = x;
+	layer->y = y;
+}
+
+void ssd1306_layer_show(ssd1306_compositor_t* comp, ssd1306_layer_t* layer, uint8_t visible)
+{
+	visible = (visible != 0);
+	if (layer->visible != visible)
+	{
+		layer->visible = visible;
+		ssd1306_compositor_damage(comp, layer->x, layer->y, layer->canvas.width, layer->canvas.height);
+	}
+}
+
+uint8_t ssd1306_compositor_present(ssd1306_compositor_t* comp)
+{
+	const ssd1306_canvas_t* screen = ssd1306_get_screen();
+	const ssd1306_layer_t* layer;
+	const ssd1306_rect_t* rect;
+	uint64_t rows, covered, column;
+	uint8_t d, i, count;
+	int16_t x, lx;
+
+	/* Columns hold 64 rows, portrait screens are left alone until rotated back */
+	if (screen->width < screen->height)
+	{
+		return 0;
+	}
+
+	/* Without internal RAM there is nothing to composite into */
+	if (screen->buffer == NULL)
+	{
+		comp->damaged = 0;
+	}
+
+	for (d = 0; d < comp->damaged; d++)
+	{
+		rect = &comp->damage[d];
+		rows = ssd1306_damage_rows(rect->y, rect->h);
+
+		for (x = rect->x; x < rect->x + rect->w; x++)
+		{
+			/* Black background, then every layer from the bottom */
+			column = 0;
+			for (i = 0; i < comp->count; i++)
+			{
+				layer = comp->layers[i];
+				lx = x - layer->x;
+				if (!layer->visible || (lx < 0) || (lx >= layer->canvas.width))
+				{
+					continue;
+				}
+				covered = ssd1306_damage_rows(layer->y, layer->canvas.height) & rows;
+				if (covered != 0)
+				{
+					column = ssd1306_damage_blend(column, covered, layer->canvas.buffer, layer->mask,
+							layer->canvas.stride, layer->canvas.height, lx, -layer->y);
+				}
+			}
+
+			ssd1306_damage_store(rect, x, column);
+		}
+
+		ssd1306_update_area(rect->x, rect->y, rect->w, rect->h);
+	}
+
+	count = comp->damaged;
+	comp->damaged = 0;
+
+	return count;
+}
@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_console.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_console.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+	const FontPageDef_t* Font;
+	ssd1306_color_t color;
+	uint8_t header;     // Fixed pages on top
+	uint8_t pitch;      // Pages per line
+	uint8_t lines;
+	uint8_t top;        // Line shown first, rotated by the start line
+	uint8_t line;       // Cursor line, counted from the first shown
+	uint16_t x;
+	uint16_t dirty_start;
+	uint16_t dirty_end;
+} ssd1306_console_t;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ssd1306_console_t ssd1306_console;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t ssd1306_console_row(uint8_t line);
+static void ssd1306_console_flush(void);
+static void ssd1306_console_newline(void);
+
+/* Private user code ---------------------------------------------------------*/
+
+uint8_t ssd1306_console_init(uint8_t header, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	uint8_t pitch = (Font->FontHeight + 7) / 8;
+
+	/* Rows are scrolled by the LCD in landscape, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return 0;
+	}
+
+	if ((header >= SSD1306_HEIGHT / 8) || (pitch > SSD1306_HEIGHT / 8 - header))
+	{
+		return 0;
+	}
+
+	ssd1306_console.Font = Font;
+	ssd1306_console.color = color;
+	ssd1306_console.header = header;
+	ssd1306_console.pitch = pitch;
+	ssd1306_console.lines = (SSD1306_HEIGHT / 8 - header) / pitch;
+
+	ssd1306_set_vertical_scroll_area(header * 8, ssd1306_console.lines * pitch * 8);
+	ssd1306_console_clear();
+
+	return 1;
+}
+
+void ssd1306_console_clear(void)
+{
+	ssd1306_console_t* con = &ssd1306_console;
+
+	/* Rows are scrolled by the LCD in landscape, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return;
+	}
+
+	ssd1306_draw_filled_rectangle(0, con->header * 8, SSD1306_WIDTH - 1, con->lines * con->pitch * 8 - 1,
+			(ssd1306_color_t)!con->color);
+	ssd1306_update_area(0, con->header * 8, SSD1306_WIDTH, con->lines * con->pitch * 8);
+
+	con->top = 0;
+	con->line = 0;
+	con->x = 0;
+	con->dirty_start = SSD1306_WIDTH;
+	con->dirty_end = 0;
+	ssd1306_set_start_line(0);
+}
+
+void ssd1306_console_puts(const char* str)
+{
+	ssd1306_console_t* con = &ssd1306_console;
+	ssd1306_text_mode_t mode = ssd1306_get_text_mode();
+	uint8_t advance;
+	int32_t glyph;
+	uint16_t ch;
+
+	/* Rows are scrolled by the LCD in landscape, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return;
+	}
+
+	/* Cells are overwritten after '\r', so their background must be drawn */
+	ssd1306_set_text_mode(ssd1306_text_opaque);
+
+	while ((ch = FONTS_DecodeUTF8(&str)) != 0)
+	{
+		if (ch == '\n')
+		{
+			ssd1306_console_newline();
+			continue;
+		}
+		if (ch == '\r')
+		{
+			ssd1306_console_flush();
+			con->x = 0;
+			continue;
+		}
+
+		/* Check character is part of font */
+		glyph = FONTS_GetGlyphIndex(con->Font, ch);
+		if (glyph < 0)
+		{
+			continue;
+		}
+		advance = FONTS_GetGlyphAdvance(con->Font, glyph);
+		if ((con->x + advance) > SSD1306_WIDTH)
+		{
+			ssd1306_console_newline();
+		}
+
+		ssd1306_goto_xy(con->x, ssd1306_console_row(con->line));
+		ssd1306_putc_unicode(ch, con->Font, con->color);
+
+		if (con->x < con->dirty_start)
+		{
+			con->dirty_start = con->x;
+		}
+		con->x += advance;
+		if (con->x > con->dirty_end)
+		{
+			con->dirty_end = con->x;
+		}
+	}
+	ssd1306_console_flush();
+
+	ssd1306_set_text_mode(mode);
+}
+
+void ssd1306_console_close(void)
+{
+	ssd1306_set_start_line(0);
+	ssd1306_set_vertical_scroll_area(0, SSD1306_HEIGHT);
+}
+
+static uint16_t ssd1306_console_row(uint8_t line)
+{
+	/* GDDRAM row holding a line, lines are rotated inside the scroll area */
+	line += ssd1306_console.top;
+	if (line >= ssd1306_console.lines)
+	{
+		line -= ssd1306_console.lines;
+	}
+	return (ssd1306_console.header + line * ssd1306_console.pitch) * 8;
+}
+
+static void ssd1306_console_flush(void)
+{
+	ssd1306_console_t* con = &ssd1306_console;
+
+	if (con->dirty_end > con->dirty_start)
+	{
+		ssd1306_update_area(con->dirty_start, ssd1306_console_row(con->line), con->dirty_end - con->dirty_start, con->pitch * 8);
+	}
+	con->dirty_start = SSD1306_WIDTH;
+	con->dirty_end = 0;
+}
+
+static void ssd1306_console_newline(void)
+{
+	ssd1306_console_t* con = &ssd1306_console;
+	uint16_t row;
+
+	ssd1306_console_flush();
+	con->x = 0;
+
+	if (con->line < con->lines - 1)
+	{
+		con->line++;
+		return;
+	}
+
+	/* The first line is cleared and becomes the last one */
+	row = ssd1306_console_row(0);
+	ssd1306_draw_filled_rectangle(0, row, SSD1306_WIDTH - 1, con->pitch * 8 - 1, (ssd1306_color_t)!con->color);
+	ssd1306_update_area(0, row, SSD1306_WIDTH, con->pitch * 8);
+
+	con->top = (con->top + 1 < con->lines) ? con->top + 1 : 0;
+	ssd1306_set_start_line(con->top * con->pitch * 8);
+}
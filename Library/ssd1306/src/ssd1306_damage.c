@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_damage.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_damage.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static ssd1306_rect_t ssd1306_damage_union(const ssd1306_rect_t* a, const ssd1306_rect_t* b);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_damage_add(ssd1306_rect_t* list, uint8_t* count, uint8_t size, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	ssd1306_rect_t rect, merged;
+	int32_t growth, best_growth;
+	uint8_t i, best;
+
+	/* Clip to screen */
+	rect.x = MAX(x, 0);
+	rect.y = MAX(y, 0);
+	rect.w = MIN(x + w, SSD1306_WIDTH) - rect.x;
+	rect.h = MIN(y + h, SSD1306_HEIGHT) - rect.y;
+	if ((rect.w <= 0) || (rect.h <= 0))
+	{
+		return;
+	}
+
+	/* Overlapping or touching areas are joined, which may make the result reach others */
+	i = 0;
+	while (i < *count)
+	{
+		if ((rect.x <= list[i].x + list[i].w) && (list[i].x <= rect.x + rect.w) &&
+			(rect.y <= list[i].y + list[i].h) && (list[i].y <= rect.y + rect.h))
+		{
+			rect = ssd1306_damage_union(&rect, &list[i]);
+			list[i] = list[--(*count)];
+			i = 0;
+		}
+		else
+		{
+			i++;
+		}
+	}
+
+	/* When full, join the area that grows the least */
+	while (*count >= size)
+	{
+		best = 0;
+		best_growth = INT32_MAX;
+		for (i = 0; i < *count; i++)
+		{
+			merged = ssd1306_damage_union(&rect, &list[i]);
+			growth = (int32_t)merged.w * merged.h - (int32_t)list[i].w * list[i].h;
+			if (growth < best_growth)
+			{
+				best_growth = growth;
+				best = i;
+			}
+		}
+		rect = ssd1306_damage_union(&rect, &list[best]);
+		list[best] = list[--(*count)];
+	}
+
+	list[(*count)++] = rect;
+}
+
+uint64_t ssd1306_damage_rows(int16_t y, int16_t h)
+{
+	/* Screen rows y to y + h - 1 as bits of a column */
+	int16_t end = MIN(y + h, SSD1306_HEIGHT);
+
+	y = MAX(y, 0);
+	if (end <= y)
+	{
+		return 0;
+	}
+	return ((end - y == 64) ? ~(uint64_t)0 : (((uint64_t)1 << (end - y)) - 1)) << y;
+}
+
+uint64_t ssd1306_damage_column(const uint8_t* data, uint16_t stride, uint16_t height, int16_t x, int16_t top)
+{
+	/* Rows top to top + 63 of a column, row top is bit 0 */
+	int16_t p, last, shift;
+	uint64_t column = 0;
+
+	last = MIN((top + 63) / 8, FONTS_PAGES(height) - 1);
+	for (p = MAX(top, 0) / 8; p <= last; p++)
+	{
+		shift = p * 8 - top;
+		if (shift >= 0)
+		{
+			column |= (uint64_t)data[p * stride + x] << shift;
+		}
+		else
+		{
+			column |= (uint64_t)data[p * stride + x] >> -shift;
+		}
+	}
+
+	return column;
+}
+
+uint64_t ssd1306_damage_blend(uint64_t column, uint64_t covered, const uint8_t* data, const uint8_t* mask,
+		uint16_t stride, uint16_t height, int16_t x, int16_t top)
+{
+	if (mask != NULL)
+	{
+		covered &= ssd1306_damage_column(mask, stride, height, x, top);
+	}
+
+	return (column & ~covered) | (ssd1306_damage_column(data, stride, height, x, top) & covered);
+}
+
+void ssd1306_damage_store(const ssd1306_rect_t* rect, int16_t x, uint64_t column)
+{
+	const ssd1306_canvas_t* screen = ssd1306_get_screen();
+	uint64_t rows = ssd1306_damage_rows(rect->y, rect->h);
+	uint8_t* dst = &screen->buffer[x];
+	uint8_t m;
+
+	/* Scatter the damaged rows back to their pages */
+	for (m = rect->y / 8; m <= (rect->y + rect->h - 1) / 8; m++)
+	{
+		dst[m * screen->stride] = (dst[m * screen->stride] & ~(uint8_t)(rows >> (m * 8))) | (uint8_t)((column & rows) >> (m * 8));
+	}
+}
+
+static ssd1306_rect_t ssd1306_damage_union(const ssd1306_rect_t* a, const ssd1306_rect_t* b)
+{
+	ssd1306_rect_t rect;
+
+	rect.x = MIN(a->x, b->x);
+	rect.y = MIN(a->y, b->y);
+	rect.w = MAX(a->x + a->w, b->x + b->w) - rect.x;
+	rect.h = MAX(a->y + a->h, b->y + b->h) - rect.y;
+
+	return rect;
+}
@@ -0,0 +1,273 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_dither.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_dither.h"
+
+/* Private includes ----------------------------------------------------------*/
+#if SSD1306_DITHER_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif SSD1306_DITHER_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_DITHER_PAD          (2)     // Error entries left and right of a row
+
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+
+/* 8x8 Bayer matrix scaled to 0-255, row by row and repeated to 16 columns for the vector loads.
+ * A pixel is white when it reaches the threshold, so 0 is always black and 255 always white */
+static const uint8_t ssd1306_dither_threshold[8][16] = {
+	{   2, 130,  34, 162,  10, 138,  42, 170,   2, 130,  34, 162,  10, 138,  42, 170 },
+	{ 194,  66, 226,  98, 202,  74, 234, 106, 194,  66, 226,  98, 202,  74, 234, 106 },
+	{  50, 178,  18, 146,  58, 186,  26, 154,  50, 178,  18, 146,  58, 186,  26, 154 },
+	{ 242, 114, 210,  82, 250, 122, 218,  90, 242, 114, 210,  82, 250, 122, 218,  90 },
+	{  14, 142,  46, 174,   6, 134,  38, 166,  14, 142,  46, 174,   6, 134,  38, 166 },
+	{ 206,  78, 238, 110, 198,  70, 230, 102, 206,  78, 238, 110, 198,  70, 230, 102 },
+	{  62, 190,  30, 158,  54, 182,  22, 150,  62, 190,  30, 158,  54, 182,  22, 150 },
+	{ 254, 126, 222,  94, 246, 118, 214,  86, 254, 126, 222,  94, 246, 118, 214,  86 },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t ssd1306_dither_kernel(uint8_t* dst, const uint8_t* src, uint16_t pitch, uint16_t w, uint8_t rows);
+static void ssd1306_dither_clip(const ssd1306_canvas_t* canvas, uint16_t* w, uint16_t* h);
+static void ssd1306_dither_rows(int16_t** row, int16_t* errors, uint16_t w);
+static void ssd1306_dither_next(int16_t** row, uint8_t count, uint16_t w);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_dither_ordered(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch)
+{
+	const uint8_t* src;
+	uint8_t* dst;
+	uint8_t rows, mask, bits, r;
+	uint16_t p, x;
+
+	ssd1306_dither_clip(canvas, &w, &h);
+
+	for (p = 0; p < FONTS_PAGES(h); p++)
+	{
+		rows = MIN(8, h - p * 8);
+		mask = 0xFF >> (8 - rows);
+		src = &gray[p * 8 * pitch];
+		dst = &canvas->buffer[p * canvas->stride];
+
+		/* Whole vectors first, then the columns left over one by one */
+		x = ssd1306_dither_kernel(dst, src, pitch, w, rows);
+		for (; x < w; x++)
+		{
+			bits = 0;
+			for (r = 0; r < rows; r++)
+			{
+				if (src[r * pitch + x] >= ssd1306_dither_threshold[r][x & 7])
+				{
+					bits |= 1 << r;
+				}
+			}
+			dst[x] = (dst[x] & ~mask) | bits;
+		}
+	}
+}
+
+void ssd1306_dither_floyd(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch, int16_t* errors)
+{
+	int16_t* row[3];
+	int16_t value, error, part, rest, right, below_left, below;
+	uint8_t* dst;
+	uint8_t bit, white;
+	uint16_t x, y;
+
+	ssd1306_dither_clip(canvas, &w, &h);
+	ssd1306_dither_rows(row, errors, w);
+
+	for (y = 0; y < h; y++)
+	{
+		dst = &canvas->buffer[(y / 8) * canvas->stride];
+		bit = 1 << (y % 8);
+
+		/* Errors going right and down are carried in locals, the next row is written once per column */
+		right = 0;
+		below_left = 0;
+		below = 0;
+		for (x = 0; x < w; x++)
+		{
+			value = gray[y * pitch + x] + row[0][x] + right;
+			white = (value >= 128);
+			dst[x] = white ? (dst[x] | bit) : (dst[x] & ~bit);
+			error = white ? (value - 255) : value;
+
+			/* 7/16 right, 3/16 down left, 5/16 down, the rest down right, so no error is lost */
+			right = error * 7 / 16;
+			rest = error - right;
+			part = error * 3 / 16;
+			row[1][x - 1] += below_left + part;
+			rest -= part;
+			part = error * 5 / 16;
+			below_left = below + part;
+			below = rest - part;
+		}
+		row[1][w - 1] += below_left;
+
+		ssd1306_dither_next(row, 2, w);
+	}
+}
+
+void ssd1306_dither_atkinson(const ssd1306_canvas_t* canvas, const uint8_t* gray, uint16_t w, uint16_t h, uint16_t pitch, int16_t* errors)
+{
+	int16_t* row[3];
+	int16_t value, error, right, right_2, below_left, below;
+	uint8_t* dst;
+	uint8_t bit, white;
+	uint16_t x, y;
+
+	ssd1306_dither_clip(canvas, &w, &h);
+	ssd1306_dither_rows(row, errors, w);
+
+	for (y = 0; y < h; y++)
+	{
+		dst = &canvas->buffer[(y / 8) * canvas->stride];
+		bit = 1 << (y % 8);
+
+		/* Errors going right and down are carried in locals, the next row is written once per column */
+		right = 0;
+		right_2 = 0;
+		below_left = 0;
+		below = 0;
+		for (x = 0; x < w; x++)
+		{
+			value = gray[y * pitch + x] + row[0][x] + right;
+			white = (value >= 128);
+			dst[x] = white ? (dst[x] | bit) : (dst[x] & ~bit);
+			error = (white ? (value - 255) : value) / 8;
+
+			/* 1/8 to each of 6 neighbours, the other 2/8 are dropped */
+			right = right_2 + error;
+			right_2 = error;
+			row[1][x - 1] += below_left + error;
+			below_left = below + error;
+			below = error;
+			row[2][x] += error;
+		}
+		row[1][w - 1] += below_left;
+
+		ssd1306_dither_next(row, 3, w);
+	}
+}
+
+#if SSD1306_DITHER_SIMD && defined(__AVX2__)
+static uint16_t ssd1306_dither_kernel(uint8_t* dst, const uint8_t* src, uint16_t pitch, uint16_t w, uint8_t rows)
+{
+	__m256i threshold[8], pixels, bits, keep;
+	uint16_t x;
+	uint8_t r;
+
+	for (r = 0; r < rows; r++)
+	{
+		threshold[r] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)ssd1306_dither_threshold[r]));
+	}
+	keep = _mm256_set1_epi8((char)(0xFF << rows));
+
+	/* Compare masks of row r ANDed with bit r and ORed together are the page bytes of 32 columns */
+	for (x = 0; (x + 32) <= w; x += 32)
+	{
+		bits = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&dst[x]), keep);
+		for (r = 0; r < rows; r++)
+		{
+			pixels = _mm256_loadu_si256((const __m256i*)&src[r * pitch + x]);
+			pixels = _mm256_cmpeq_epi8(_mm256_max_epu8(pixels, threshold[r]), pixels);
+			bits = _mm256_or_si256(bits, _mm256_and_si256(pixels, _mm256_set1_epi8((char)(1 << r))));
+		}
+		_mm256_storeu_si256((__m256i*)&dst[x], bits);
+	}
+
+	return x;
+}
+#elif SSD1306_DITHER_SIMD && defined(__SSE2__)
+static uint16_t ssd1306_dither_kernel(uint8_t* dst, const uint8_t* src, uint16_t pitch, uint16_t w, uint8_t rows)
+{
+	__m128i threshold[8], pixels, bits, keep;
+	uint16_t x;
+	uint8_t r;
+
+	for (r = 0; r < rows; r++)
+	{
+		threshold[r] = _mm_loadu_si128((const __m128i*)ssd1306_dither_threshold[r]);
+	}
+	keep = _mm_set1_epi8((char)(0xFF << rows));
+
+	/* Compare masks of row r ANDed with bit r and ORed together are the page bytes of 16 columns */
+	for (x = 0; (x + 16) <= w; x += 16)
+	{
+		bits = _mm_and_si128(_mm_loadu_si128((const __m128i*)&dst[x]), keep);
+		for (r = 0; r < rows; r++)
+		{
+			pixels = _mm_loadu_si128((const __m128i*)&src[r * pitch + x]);
+			pixels = _mm_cmpeq_epi8(_mm_max_epu8(pixels, threshold[r]), pixels);
+			bits = _mm_or_si128(bits, _mm_and_si128(pixels, _mm_set1_epi8((char)(1 << r))));
+		}
+		_mm_storeu_si128((__m128i*)&dst[x], bits);
+	}
+
+	return x;
+}
+#else
+static uint16_t ssd1306_dither_kernel(uint8_t* dst, const uint8_t* src, uint16_t pitch, uint16_t w, uint8_t rows)
+{
+	(void)dst;
+	(void)src;
+	(void)pitch;
+	(void)w;
+	(void)rows;
+
+	/* No vector unit, every column is done by the portable loop */
+	return 0;
+}
+#endif
+
+static void ssd1306_dither_clip(const ssd1306_canvas_t* canvas, uint16_t* w, uint16_t* h)
+{
+	*w = MIN(*w, canvas->width);
+	*h = MIN(*h, canvas->height);
+}
+
+static void ssd1306_dither_rows(int16_t** row, int16_t* errors, uint16_t w)
+{
+	uint8_t i;
+
+	memset(errors, 0, SSD1306_DITHER_ERRORS(w) * sizeof(int16_t));
+	for (i = 0; i < 3; i++)
+	{
+		row[i] = &errors[i * (w + 2 * SSD1306_DITHER_PAD) + SSD1306_DITHER_PAD];
+	}
+}
+
+static void ssd1306_dither_next(int16_t** row, uint8_t count, uint16_t w)
+{
+	int16_t* done = row[0];
+	uint8_t i;
+
+	/* The finished row is cleared and becomes the last one */
+	for (i = 0; i < (count - 1); i++)
+	{
+		row[i] = row[i + 1];
+	}
+	row[count - 1] = done;
+	memset(&done[-SSD1306_DITHER_PAD], 0, (w + 2 * SSD1306_DITHER_PAD) * sizeof(int16_t));
+}
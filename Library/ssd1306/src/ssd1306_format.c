@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_format.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_format.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t ssd1306_format_number(char* buf, uint32_t value, uint8_t negative, uint8_t decimals, uint8_t width, char pad);
+
+/* Private user code ---------------------------------------------------------*/
+
+uint8_t ssd1306_format_uint(char* buf, uint32_t value, uint8_t width, char pad)
+{
+	return ssd1306_format_number(buf, value, 0, 0, width, pad);
+}
+
+uint8_t ssd1306_format_int(char* buf, int32_t value, uint8_t width, char pad)
+{
+	/* Unsigned negation also handles INT32_MIN */
+	return ssd1306_format_number(buf, (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value, value < 0, 0, width, pad);
+}
+
+uint8_t ssd1306_format_fixed(char* buf, int32_t value, uint8_t decimals, uint8_t width, char pad)
+{
+	return ssd1306_format_number(buf, (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value, value < 0,
+			(decimals > 9) ? 9 : decimals, width, pad);
+}
+
+static uint8_t ssd1306_format_number(char* buf, uint32_t value, uint8_t negative, uint8_t decimals, uint8_t width, char pad)
+{
+	char digits[SSD1306_FORMAT_SIZE];
+	uint8_t count = 0, length, i = 0;
+
+	/* Digits from the right, at least one before the decimal point */
+	do
+	{
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+		if ((count == decimals) && (decimals != 0))
+		{
+			digits[count++] = '.';
+			if (value == 0)
+			{
+				digits[count++] = '0';
+			}
+		}
+	} while ((value != 0) || (count < decimals));
+
+	length = count + negative;
+
+	/* Sign goes before zero padding, after space padding */
+	if (negative && (pad == '0'))
+	{
+		buf[i++] = '-';
+	}
+	for (; length < width; length++)
+	{
+		buf[i++] = pad;
+	}
+	if (negative && (pad != '0'))
+	{
+		buf[i++] = '-';
+	}
+
+	/* Digits were stored backwards */
+	while (count != 0)
+	{
+		buf[i++] = digits[--count];
+	}
+	buf[i] = '\0';
+
+	return i;
+}
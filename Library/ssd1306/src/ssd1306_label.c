@@ -0,0 +1,206 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_label.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_label.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+	const FontPageDef_t* Font;
+	uint32_t hash;
+	uint32_t stamp;     // Last use, for LRU eviction
+	uint16_t offset;    // Bitmap inside memory, followed by the string
+	uint16_t size;
+	uint16_t width;
+	uint8_t clipped;    // Cut at the screen width it was rendered for
+} ssd1306_label_entry_t;
+
+typedef struct
+{
+	uint8_t* memory;
+	uint16_t size;
+	uint16_t used;
+	uint8_t count;
+	uint32_t clock;
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+	ssd1306_label_entry_t entries[SSD1306_LABEL_ENTRIES]; // Sorted by offset
+} ssd1306_label_cache_t;
+
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_LABEL_HASH_BASIS    (2166136261UL) // FNV-1a
+#define SSD1306_LABEL_HASH_PRIME    (16777619UL)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ssd1306_label_cache_t ssd1306_label;
+
+/* Private function prototypes -----------------------------------------------*/
+static int16_t ssd1306_label_find(const char* str, const FontPageDef_t* Font, uint32_t hash);
+static void ssd1306_label_evict(uint8_t index);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_label_init(uint8_t* memory, uint16_t size)
+{
+	ssd1306_label.memory = memory;
+	ssd1306_label.size = (memory != NULL) ? size : 0;
+	ssd1306_label.hits = 0;
+	ssd1306_label.misses = 0;
+	ssd1306_label.evictions = 0;
+	ssd1306_label_clear();
+}
+
+void ssd1306_label_clear(void)
+{
+	ssd1306_label.used = 0;
+	ssd1306_label.count = 0;
+	ssd1306_label.clock = 0;
+}
+
+uint16_t ssd1306_label_draw(int16_t x, int16_t y, const char* str, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	ssd1306_label_entry_t* entry;
+	uint32_t hash = SSD1306_LABEL_HASH_BASIS;
+	uint16_t length, width, size, i;
+	uint8_t clipped;
+	int16_t index;
+
+	/* Hash string */
+	for (length = 0; str[length] != '\0'; length++)
+	{
+		hash = (hash ^ (uint8_t)str[length]) * SSD1306_LABEL_HASH_PRIME;
+	}
+
+	index = ssd1306_label_find(str, Font, hash);
+
+	/* A label cut for the other orientation is rendered again */
+	if ((index >= 0) && ssd1306_label.entries[index].clipped && (ssd1306_label.entries[index].width != ssd1306_get_screen()->width))
+	{
+		ssd1306_label_evict(index);
+		index = -1;
+	}
+
+	if (index < 0)
+	{
+		ssd1306_label.misses++;
+
+		/* Check label fits in the budget */
+		width = FONTS_GetStringWidth(str, Font);
+		clipped = (width > ssd1306_get_screen()->width) ? 1 : 0;
+		if (clipped)
+		{
+			width = ssd1306_get_screen()->width;
+		}
+		size = width * FONTS_PAGES(Font->FontHeight) + length + 1;
+		if ((width == 0) || (size > ssd1306_label.size))
+		{
+			ssd1306_goto_xy(x, y);
+			ssd1306_puts_page(str, Font, color);
+			return width;
+		}
+
+		/* Drop least recently used labels until it fits */
+		while ((ssd1306_label.count == SSD1306_LABEL_ENTRIES) || ((ssd1306_label.size - ssd1306_label.used) < size))
+		{
+			index = 0;
+			for (i = 1; i < ssd1306_label.count; i++)
+			{
+				if (ssd1306_label.entries[i].stamp < ssd1306_label.entries[index].stamp)
+				{
+					index = i;
+				}
+			}
+			ssd1306_label_evict(index);
+		}
+
+		/* Render glyph bits once, string is kept to tell hash collisions apart */
+		index = ssd1306_label.count++;
+		entry = &ssd1306_label.entries[index];
+		entry->Font = Font;
+		entry->hash = hash;
+		entry->offset = ssd1306_label.used;
+		entry->size = size;
+		entry->width = width;
+		entry->clipped = clipped;
+		ssd1306_puts_bitmap(&ssd1306_label.memory[entry->offset], width, Font->FontHeight, str, Font);
+		memcpy(&ssd1306_label.memory[entry->offset + size - length - 1], str, length + 1);
+		ssd1306_label.used += size;
+	}
+	else
+	{
+		ssd1306_label.hits++;
+	}
+
+	/* A hit is a blit */
+	entry = &ssd1306_label.entries[index];
+	entry->stamp = ++ssd1306_label.clock;
+	ssd1306_draw_columns(x, y, &ssd1306_label.memory[entry->offset], entry->width, Font->FontHeight, color);
+
+	return entry->width;
+}
+
+void ssd1306_label_get_stats(ssd1306_label_stats_t* stats)
+{
+	uint32_t total = ssd1306_label.hits + ssd1306_label.misses;
+
+	stats->hits = ssd1306_label.hits;
+	stats->misses = ssd1306_label.misses;
+	stats->evictions = ssd1306_label.evictions;
+	stats->hit_rate = (total != 0) ? (uint8_t)((uint64_t)ssd1306_label.hits * 100 / total) : 0;
+	stats->entries = ssd1306_label.count;
+	stats->used = ssd1306_label.used;
+	stats->size = ssd1306_label.size;
+}
+
+static int16_t ssd1306_label_find(const char* str, const FontPageDef_t* Font, uint32_t hash)
+{
+	const ssd1306_label_entry_t* entry;
+	uint8_t i;
+
+	for (i = 0; i < ssd1306_label.count; i++)
+	{
+		entry = &ssd1306_label.entries[i];
+		if ((entry->hash == hash) && (entry->Font == Font) &&
+			(strcmp((const char*)&ssd1306_label.memory[entry->offset + entry->width * FONTS_PAGES(Font->FontHeight)], str) == 0))
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+/* Removes a label and packs the labels after it, so free memory stays in one block */
+static void ssd1306_label_evict(uint8_t index)
+{
+	ssd1306_label_entry_t* entry = &ssd1306_label.entries[index];
+	uint16_t end = entry->offset + entry->size;
+	uint16_t size = entry->size;
+	uint8_t i;
+
+	memmove(&ssd1306_label.memory[entry->offset], &ssd1306_label.memory[end], ssd1306_label.used - end);
+	ssd1306_label.used -= size;
+	ssd1306_label.count--;
+	ssd1306_label.evictions++;
+
+	for (i = index; i < ssd1306_label.count; i++)
+	{
+		ssd1306_label.entries[i] = ssd1306_label.entries[i + 1];
+		ssd1306_label.entries[i].offset -= size;
+	}
+}
@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_layout.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_layout.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t ssd1306_layout_cached(const ssd1306_layout_t* layout, const char* str);
+static void ssd1306_layout_keep(ssd1306_layout_t* layout, const char* str);
+static uint16_t ssd1306_layout_break(const ssd1306_layout_t* layout, uint16_t pos, ssd1306_layout_line_t* line);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_layout_init(ssd1306_layout_t* layout, int16_t x, int16_t y, uint16_t w, uint16_t h,
+		const FontPageDef_t* Font, ssd1306_align_t align)
+{
+	layout->Font = Font;
+	layout->x = x;
+	layout->y = y;
+	layout->w = w;
+	layout->h = h;
+	layout->align = align;
+	layout->spacing = 0;
+	layout->str = NULL;
+	layout->valid = 0;
+	layout->truncated = 0;
+	layout->count = 0;
+	layout->width = 0;
+	layout->height = 0;
+}
+
+uint8_t ssd1306_layout_text(ssd1306_layout_t* layout, const char* str)
+{
+	ssd1306_layout_line_t* line;
+	uint16_t pos = 0, top = 0;
+
+	/* Same text in the same box, lines are still valid */
+	if (ssd1306_layout_cached(layout, str))
+	{
+		return layout->count;
+	}
+
+	layout->str = str;
+	layout->truncated = 0;
+	layout->count = 0;
+	layout->width = 0;
+
+	while (1)
+	{
+		/* Spaces left by a word wrap are skipped */
+		while (str[pos] == ' ')
+		{
+			pos++;
+		}
+		if (str[pos] == '\0')
+		{
+			break;
+		}
+
+		/* Check line fits in the box */
+		if ((layout->count == SSD1306_LAYOUT_LINES) || ((top + layout->Font->FontHeight) > layout->h))
+		{
+			layout->truncated = 1;
+			break;
+		}
+
+		line = &layout->lines[layout->count++];
+		pos = ssd1306_layout_break(layout, pos, line);
+
+		/* Align line in the box */
+		line->x = layout->x;
+		if (layout->align == ssd1306_align_center)
+		{
+			line->x += (layout->w - line->width) / 2;
+		}
+		else if (layout->align == ssd1306_align_right)
+		{
+			line->x += layout->w - line->width;
+		}
+		line->y = layout->y + top;
+
+		if (line->width > layout->width)
+		{
+			layout->width = line->width;
+		}
+		top += layout->Font->FontHeight + layout->spacing;
+	}
+
+	layout->height = (layout->count != 0) ? (top - layout->spacing) : 0;
+	ssd1306_layout_keep(layout, str);
+
+	return layout->count;
+}
+
+void ssd1306_layout_draw(const ssd1306_layout_t* layout, ssd1306_color_t color)
+{
+	const ssd1306_layout_line_t* line;
+	const char* str;
+	const char* end;
+	uint8_t i;
+
+	for (i = 0; i < layout->count; i++)
+	{
+		line = &layout->lines[i];
+		str = &layout->str[line->offset];
+		end = str + line->length;
+
+		/* Characters that are not part of the font were not measured */
+		ssd1306_goto_xy(line->x, line->y);
+		while (str < end)
+		{
+			ssd1306_putc_unicode(FONTS_DecodeUTF8(&str), layout->Font, color);
+		}
+	}
+}
+
+/* A string changed in place keeps its pointer, so the text itself is compared too */
+static uint8_t ssd1306_layout_cached(const ssd1306_layout_t* layout, const char* str)
+{
+	const ssd1306_layout_key_t* key = &layout->key;
+
+	return layout->valid && (layout->str == str) && (key->Font == layout->Font) &&
+		(key->x == layout->x) && (key->y == layout->y) && (key->w == layout->w) && (key->h == layout->h) &&
+		(key->align == layout->align) && (key->spacing == layout->spacing) && (strcmp(layout->text, str) == 0);
+}
+
+/* Strings that do not fit in the copy are measured on every call */
+static void ssd1306_layout_keep(ssd1306_layout_t* layout, const char* str)
+{
+	size_t length = strlen(str);
+
+	layout->valid = 0;
+	if (length >= SSD1306_LAYOUT_TEXT)
+	{
+		return;
+	}
+
+	memcpy(layout->text, str, length + 1);
+	layout->key.Font = layout->Font;
+	layout->key.x = layout->x;
+	layout->key.y = layout->y;
+	layout->key.w = layout->w;
+	layout->key.h = layout->h;
+	layout->key.align = layout->align;
+	layout->key.spacing = layout->spacing;
+	layout->valid = 1;
+}
+
+/* Finds the end of the line starting at pos, returns where the next line starts */
+static uint16_t ssd1306_layout_break(const ssd1306_layout_t* layout, uint16_t pos, ssd1306_layout_line_t* line)
+{
+	const char* str = layout->str;
+	const char* next;
+	uint16_t width = 0, end, end_width = 0;
+	uint16_t wrap = 0, wrap_end = 0, wrap_width = 0;
+	uint8_t advance;
+	int32_t glyph;
+	uint16_t ch;
+
+	line->offset = pos;
+	end = pos;
+
+	while (str[pos] != '\0')
+	{
+		next = &str[pos];
+		ch = FONTS_DecodeUTF8(&next);
+
+		/* Explicit line break */
+		if (ch == '\n')
+		{
+			pos++;
+			break;
+		}
+
+		glyph = FONTS_GetGlyphIndex(layout->Font, ch);
+		advance = (glyph < 0) ? 0 : FONTS_GetGlyphAdvance(layout->Font, glyph);
+
+		if (ch == ' ')
+		{
+			/* Possible break, the line would end after the last word */
+			if (end != line->offset)
+			{
+				wrap = next - str;
+				wrap_end = end;
+				wrap_width = end_width;
+			}
+		}
+		else if ((width + advance) > layout->w)
+		{
+			if (wrap != 0)
+			{
+				/* Word wrap, the word starts the next line */
+				end = wrap_end;
+				end_width = wrap_width;
+				pos = wrap;
+			}
+			else if (end == line->offset)
+			{
+				/* A character wider than the box still takes a line */
+				end = pos = next - str;
+				end_width = advance;
+			}
+			break;
+		}
+
+		width += advance;
+		pos = next - str;
+
+		/* Trailing spaces are not part of the line */
+		if (ch != ' ')
+		{
+			end = pos;
+			end_width = width;
+		}
+	}
+
+	line->length = end - line->offset;
+	line->width = end_width;
+	return pos;
+}
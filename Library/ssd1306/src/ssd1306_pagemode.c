@@ -0,0 +1,346 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_pagemode.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_pagemode.h"
+#include "ssd1306_hal.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+
+/* Display list commands: op, page span, arguments, then pointer and string when used */
+typedef enum
+{
+	ssd1306_pagemode_op_fill = 0,
+	ssd1306_pagemode_op_text_mode,
+	ssd1306_pagemode_op_pixel,
+	ssd1306_pagemode_op_line,
+	ssd1306_pagemode_op_rectangle,
+	ssd1306_pagemode_op_filled_rectangle,
+	ssd1306_pagemode_op_triangle,
+	ssd1306_pagemode_op_circle,
+	ssd1306_pagemode_op_filled_circle,
+	ssd1306_pagemode_op_bitmap,
+	ssd1306_pagemode_op_columns,
+	ssd1306_pagemode_op_canvas,
+	ssd1306_pagemode_op_puts,
+	ssd1306_pagemode_op_puts_page
+} ssd1306_pagemode_op_t;
+
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_PAGEMODE_ARGS_MAX   (7)
+#define SSD1306_PAGEMODE_ALL_PAGES  (((SSD1306_HEIGHT / 8) - 1) & 0x0F)
+
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Arguments of each command, indexed by ssd1306_pagemode_op_t */
+static const uint8_t ssd1306_pagemode_args[] = { 1, 1, 3, 5, 5, 5, 7, 4, 4, 5, 5, 2, 3, 3 };
+
+/* Commands followed by a pointer, indexed by ssd1306_pagemode_op_t */
+static const uint8_t ssd1306_pagemode_pointer[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 };
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t ssd1306_pagemode_span(int32_t top, int32_t bottom);
+static uint8_t ssd1306_pagemode_record(ssd1306_pagemode_t* pm, ssd1306_pagemode_op_t op, uint8_t span, const int16_t* args, const void* ptr, const char* str);
+static const uint8_t* ssd1306_pagemode_play(const uint8_t* cmd, uint8_t page);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_pagemode_init(ssd1306_pagemode_t* pm, uint8_t* list, uint16_t size)
+{
+	pm->list = list;
+	pm->size = size;
+	ssd1306_pagemode_begin(pm);
+}
+
+void ssd1306_pagemode_begin(ssd1306_pagemode_t* pm)
+{
+	pm->used = 0;
+	pm->overflow = 0;
+}
+
+void ssd1306_pagemode_render(ssd1306_pagemode_t* pm)
+{
+	ssd1306_text_mode_t mode = ssd1306_get_text_mode();
+	const uint8_t* cmd;
+	uint8_t* buffer;
+	uint8_t page;
+
+	/* Pages are replayed in landscape, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return;
+	}
+
+	for (page = 0; page < (SSD1306_HEIGHT / 8); page++)
+	{
+		/* Every page starts from the same state */
+		buffer = pm->page[page % SSD1306_PAGEMODE_BUFFERS];
+		memset(buffer, 0x00, SSD1306_WIDTH);
+		ssd1306_set_page_canvas(buffer, page);
+		ssd1306_set_text_mode(mode);
+
+		for (cmd = pm->list; cmd < &pm->list[pm->used]; )
+		{
+			cmd = ssd1306_pagemode_play(cmd, page);
+		}
+
+		/* Page is done, send it while the next one is drawn */
+		ssd1306_i2c_command(0xB0 + page);
+		ssd1306_i2c_command(0x00);
+		ssd1306_i2c_command(0x10);
+		ssd1306_i2c_write_multi(0x40, buffer, SSD1306_WIDTH);
+	}
+
+	ssd1306_set_text_mode(mode);
+	ssd1306_set_canvas(NULL);
+}
+
+uint8_t ssd1306_pagemode_fill(ssd1306_pagemode_t* pm, ssd1306_color_t color)
+{
+	int16_t args[1] = { color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_fill, SSD1306_PAGEMODE_ALL_PAGES, args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_text_mode(ssd1306_pagemode_t* pm, ssd1306_text_mode_t mode)
+{
+	int16_t args[1] = { mode };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_text_mode, SSD1306_PAGEMODE_ALL_PAGES, args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_pixel(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, ssd1306_color_t color)
+{
+	int16_t args[3] = { x, y, color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_pixel, ssd1306_pagemode_span(y, y), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_line(ssd1306_pagemode_t* pm, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ssd1306_color_t c)
+{
+	int16_t args[5] = { x0, y0, x1, y1, c };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_line, ssd1306_pagemode_span(MIN(y0, y1), MAX(y0, y1)), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_rectangle(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c)
+{
+	int16_t args[5] = { x, y, w, h, c };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_rectangle, ssd1306_pagemode_span(y, (int32_t)y + h), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_filled_rectangle(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, uint16_t w, uint16_t h, ssd1306_color_t c)
+{
+	int16_t args[5] = { x, y, w, h, c };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_filled_rectangle, ssd1306_pagemode_span(y, (int32_t)y + h), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_triangle(ssd1306_pagemode_t* pm, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, ssd1306_color_t color)
+{
+	int16_t args[7] = { x1, y1, x2, y2, x3, y3, color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_triangle, ssd1306_pagemode_span(MIN(MIN(y1, y2), y3), MAX(MAX(y1, y2), y3)), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_circle(ssd1306_pagemode_t* pm, int16_t x0, int16_t y0, int16_t r, ssd1306_color_t c)
+{
+	int16_t args[4] = { x0, y0, r, c };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_circle, ssd1306_pagemode_span((int32_t)y0 - r, (int32_t)y0 + r), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_filled_circle(ssd1306_pagemode_t* pm, int16_t x0, int16_t y0, int16_t r, ssd1306_color_t c)
+{
+	int16_t args[4] = { x0, y0, r, c };
+
+	/* Spans are clipped to the screen, so only rows y0 - r to y0 + r are touched */
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_filled_circle, ssd1306_pagemode_span((int32_t)y0 - r, (int32_t)y0 + r), args, NULL, NULL);
+}
+
+uint8_t ssd1306_pagemode_bitmap(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color)
+{
+	int16_t args[5] = { x, y, w, h, (int16_t)color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_bitmap, ssd1306_pagemode_span(y, (int32_t)y + h - 1), args, bitmap, NULL);
+}
+
+uint8_t ssd1306_pagemode_columns(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const uint8_t* data, uint16_t w, uint16_t h, ssd1306_color_t color)
+{
+	int16_t args[5] = { x, y, w, h, color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_columns, ssd1306_pagemode_span(y, (int32_t)y + h - 1), args, data, NULL);
+}
+
+uint8_t ssd1306_pagemode_canvas(ssd1306_pagemode_t* pm, int16_t x, int16_t y, const ssd1306_canvas_t* canvas)
+{
+	int16_t args[2] = { x, y };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_canvas, ssd1306_pagemode_span(y, (int32_t)y + canvas->height - 1), args, canvas, NULL);
+}
+
+uint8_t ssd1306_pagemode_puts(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, const char* str, FontDef_t* Font, ssd1306_color_t color)
+{
+	int16_t args[3] = { x, y, color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_puts, ssd1306_pagemode_span(y, (int32_t)y + Font->FontHeight - 1), args, Font, str);
+}
+
+uint8_t ssd1306_pagemode_puts_page(ssd1306_pagemode_t* pm, uint16_t x, uint16_t y, const char* str, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	int16_t args[3] = { x, y, color };
+
+	return ssd1306_pagemode_record(pm, ssd1306_pagemode_op_puts_page, ssd1306_pagemode_span(y, (int32_t)y + Font->FontHeight - 1), args, Font, str);
+}
+
+static uint8_t ssd1306_pagemode_span(int32_t top, int32_t bottom)
+{
+	/* Rows outside the screen are clamped, as the drawing functions do */
+	top = MIN(MAX(top, 0), SSD1306_HEIGHT - 1);
+	bottom = MIN(MAX(bottom, top), SSD1306_HEIGHT - 1);
+
+	/* First page in the high nibble, last page in the low one */
+	return (uint8_t)(((top / 8) << 4) | (bottom / 8));
+}
+
+static uint8_t ssd1306_pagemode_record(ssd1306_pagemode_t* pm, ssd1306_pagemode_op_t op, uint8_t span, const int16_t* args, const void* ptr, const char* str)
+{
+	uint16_t size = 2 + ssd1306_pagemode_args[op] * sizeof(int16_t);
+	uint16_t length = 0;
+	uint8_t* dst;
+
+	if (ssd1306_pagemode_pointer[op])
+	{
+		size += sizeof(ptr);
+	}
+	if (str != NULL)
+	{
+		length = strlen(str) + 1;
+		size += length;
+	}
+
+	/* Check available space in the display list */
+	if ((pm->used + size) > pm->size)
+	{
+		pm->overflow = 1;
+		return 0;
+	}
+
+	dst = &pm->list[pm->used];
+	pm->used += size;
+
+	*dst++ = op;
+	*dst++ = span;
+	memcpy(dst, args, ssd1306_pagemode_args[op] * sizeof(int16_t));
+	dst += ssd1306_pagemode_args[op] * sizeof(int16_t);
+	if (ssd1306_pagemode_pointer[op])
+	{
+		memcpy(dst, &ptr, sizeof(ptr));
+		dst += sizeof(ptr);
+	}
+	if (str != NULL)
+	{
+		memcpy(dst, str, length);
+	}
+
+	return 1;
+}
+
+static const uint8_t* ssd1306_pagemode_play(const uint8_t* cmd, uint8_t page)
+{
+	int16_t a[SSD1306_PAGEMODE_ARGS_MAX];
+	const void* ptr = NULL;
+	char* str = NULL;
+	uint8_t op, span;
+
+	op = *cmd++;
+	span = *cmd++;
+	memcpy(a, cmd, ssd1306_pagemode_args[op] * sizeof(int16_t));
+	cmd += ssd1306_pagemode_args[op] * sizeof(int16_t);
+	if (ssd1306_pagemode_pointer[op])
+	{
+		memcpy(&ptr, cmd, sizeof(ptr));
+		cmd += sizeof(ptr);
+	}
+	if ((op == ssd1306_pagemode_op_puts) || (op == ssd1306_pagemode_op_puts_page))
+	{
+		str = (char*)cmd;
+		cmd += strlen(str) + 1;
+	}
+
+	/* Commands not crossing this page are skipped */
+	if ((page < (span >> 4)) || (page > (span & 0x0F)))
+	{
+		return cmd;
+	}
+
+	switch (op)
+	{
+	case ssd1306_pagemode_op_fill:
+		ssd1306_fill((ssd1306_color_t)a[0]);
+		break;
+	case ssd1306_pagemode_op_text_mode:
+		ssd1306_set_text_mode((ssd1306_text_mode_t)a[0]);
+		break;
+	case ssd1306_pagemode_op_pixel:
+		ssd1306_draw_pixel(a[0], a[1], (ssd1306_color_t)a[2]);
+		break;
+	case ssd1306_pagemode_op_line:
+		ssd1306_draw_line(a[0], a[1], a[2], a[3], (ssd1306_color_t)a[4]);
+		break;
+	case ssd1306_pagemode_op_rectangle:
+		ssd1306_draw_rectangle(a[0], a[1], a[2], a[3], (ssd1306_color_t)a[4]);
+		break;
+	case ssd1306_pagemode_op_filled_rectangle:
+		ssd1306_draw_filled_rectangle(a[0], a[1], a[2], a[3], (ssd1306_color_t)a[4]);
+		break;
+	case ssd1306_pagemode_op_triangle:
+		ssd1306_draw_triangle(a[0], a[1], a[2], a[3], a[4], a[5], (ssd1306_color_t)a[6]);
+		break;
+	case ssd1306_pagemode_op_circle:
+		ssd1306_draw_circle(a[0], a[1], a[2], (ssd1306_color_t)a[3]);
+		break;
+	case ssd1306_pagemode_op_filled_circle:
+		ssd1306_draw_filled_circle(a[0], a[1], a[2], (ssd1306_color_t)a[3]);
+		break;
+	case ssd1306_pagemode_op_bitmap:
+		ssd1306_draw_bitmap(a[0], a[1], (const unsigned char*)ptr, a[2], a[3], a[4]);
+		break;
+	case ssd1306_pagemode_op_columns:
+		ssd1306_draw_columns(a[0], a[1], (const uint8_t*)ptr, a[2], a[3], (ssd1306_color_t)a[4]);
+		break;
+	case ssd1306_pagemode_op_canvas:
+		ssd1306_draw_canvas(a[0], a[1], (const ssd1306_canvas_t*)ptr);
+		break;
+	case ssd1306_pagemode_op_puts:
+		ssd1306_goto_xy(a[0], a[1]);
+		ssd1306_puts(str, (FontDef_t*)ptr, (ssd1306_color_t)a[2]);
+		break;
+	case ssd1306_pagemode_op_puts_page:
+		ssd1306_goto_xy(a[0], a[1]);
+		ssd1306_puts_page(str, (const FontPageDef_t*)ptr, (ssd1306_color_t)a[2]);
+		break;
+	default:
+		break;
+	}
+
+	return cmd;
+}
@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_panels.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_panels.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_PANELS_COMMAND      (0x00)
+#define SSD1306_PANELS_DATA         (0x40)
+
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void ssd1306_panels_wait(ssd1306_panels_t* display);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_panels_init(ssd1306_panels_t* display, uint8_t* buffer, uint16_t w, uint16_t h)
+{
+	ssd1306_canvas_init(&display->canvas, buffer, w, h);
+	memset(buffer, 0x00, w * FONTS_PAGES(h));
+	display->count = 0;
+}
+
+uint8_t ssd1306_panels_add(ssd1306_panels_t* display, const ssd1306_transport_t* transport, int16_t x, uint8_t page)
+{
+	ssd1306_panel_t* panel;
+
+	/* Check input parameters */
+	if ((display->count >= SSD1306_PANELS_MAX) || (x < 0) || ((x + SSD1306_WIDTH) > display->canvas.width) ||
+		((page + SSD1306_PANEL_PAGES) * 8 > display->canvas.height))
+	{
+		return 0;
+	}
+
+	panel = &display->panels[display->count++];
+	panel->transport = *transport;
+	panel->x = x;
+	panel->page = page;
+	memset(panel->first, SSD1306_WIDTH, sizeof(panel->first));
+	memset(panel->last, 0, sizeof(panel->last));
+
+	/* Same setup as the LCD of ssd1306_init(), in one transfer */
+	panel->transport.write(panel->transport.bus, panel->transport.address, SSD1306_PANELS_COMMAND, ssd1306_init_sequence, SSD1306_INIT_SEQUENCE_SIZE);
+	ssd1306_panels_damage(display, x, page * 8, SSD1306_WIDTH, SSD1306_HEIGHT);
+
+	return 1;
+}
+
+void ssd1306_panels_command(ssd1306_panels_t* display, const uint8_t* commands, uint16_t count)
+{
+	ssd1306_panel_t* panel;
+	uint8_t i;
+
+	for (i = 0; i < display->count; i++)
+	{
+		panel = &display->panels[i];
+		panel->transport.write(panel->transport.bus, panel->transport.address, SSD1306_PANELS_COMMAND, commands, count);
+	}
+}
+
+void ssd1306_panels_damage(ssd1306_panels_t* display, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	ssd1306_panel_t* panel;
+	int16_t left, right, top, bottom;
+	uint8_t i, p;
+
+	for (i = 0; i < display->count; i++)
+	{
+		panel = &display->panels[i];
+
+		/* Part of the rectangle on this panel, in panel coordinates */
+		left = MAX(x - panel->x, 0);
+		right = MIN(x + w - panel->x, SSD1306_WIDTH);
+		top = MAX(y - panel->page * 8, 0);
+		bottom = MIN(y + h - panel->page * 8, SSD1306_HEIGHT);
+		if ((left >= right) || (top >= bottom))
+		{
+			continue;
+		}
+
+		for (p = top / 8; p <= (bottom - 1) / 8; p++)
+		{
+			if (panel->first[p] > panel->last[p])
+			{
+				panel->first[p] = left;
+				panel->last[p] = right - 1;
+			}
+			else
+			{
+				panel->first[p] = MIN(panel->first[p], left);
+				panel->last[p] = MAX(panel->last[p], right - 1);
+			}
+		}
+	}
+}
+
+void ssd1306_panels_invalidate(ssd1306_panels_t* display)
+{
+	ssd1306_panel_t* panel;
+	uint8_t i;
+
+	for (i = 0; i < display->count; i++)
+	{
+		panel = &display->panels[i];
+		ssd1306_panels_damage(display, panel->x, panel->page * 8, SSD1306_WIDTH, SSD1306_HEIGHT);
+	}
+}
+
+uint32_t ssd1306_panels_flush(ssd1306_panels_t* display)
+{
+	const ssd1306_canvas_t* canvas = &display->canvas;
+	ssd1306_panel_t* panel;
+	uint32_t count = 0;
+	uint8_t i, p, n;
+
+	/* One page of every panel in turn, so separate buses work at the same time */
+	for (p = 0; p < SSD1306_PANEL_PAGES; p++)
+	{
+		for (i = 0; i < display->count; i++)
+		{
+			panel = &display->panels[i];
+			if (panel->first[p] > panel->last[p])
+			{
+				continue;
+			}
+
+			n = panel->last[p] - panel->first[p] + 1;
+			panel->command[0] = 0xB0 + p;
+			panel->command[1] = 0x00 | (panel->first[p] & 0x0F);
+			panel->command[2] = 0x10 | (panel->first[p] >> 4);
+
+			/* Display data goes out straight from the logical surface */
+			panel->transport.write(panel->transport.bus, panel->transport.address, SSD1306_PANELS_COMMAND, panel->command, 3);
+			panel->transport.write(panel->transport.bus, panel->transport.address, SSD1306_PANELS_DATA,
+					&canvas->buffer[(panel->page + p) * canvas->stride + panel->x + panel->first[p]], n);
+			count += n;
+
+			panel->first[p] = SSD1306_WIDTH;
+			panel->last[p] = 0;
+		}
+	}
+
+	/* The surface may be drawn again once every transfer is over */
+	ssd1306_panels_wait(display);
+
+	return count;
+}
+
+static void ssd1306_panels_wait(ssd1306_panels_t* display)
+{
+	ssd1306_panel_t* panel;
+	uint8_t i;
+
+	for (i = 0; i < display->count; i++)
+	{
+		panel = &display->panels[i];
+		if (panel->transport.wait != NULL)
+		{
+			panel->transport.wait(panel->transport.bus);
+		}
+	}
+}
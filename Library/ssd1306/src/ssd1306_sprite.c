@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_sprite.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_sprite.h"
+#include "ssd1306_damage.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_sprite_list_init(ssd1306_sprite_list_t* list, const ssd1306_canvas_t* background)
+{
+	list->background = background;
+	list->count = 0;
+	list->damaged = 0;
+}
+
+void ssd1306_sprite_init(ssd1306_sprite_t* sprite, const uint8_t* bitmap, const uint8_t* mask, uint16_t w, uint16_t h, uint8_t z)
+{
+	sprite->bitmap = bitmap;
+	sprite->mask = mask;
+	sprite->w = w;
+	sprite->h = h;
+	sprite->x = 0;
+	sprite->y = 0;
+	sprite->z = z;
+	sprite->visible = 1;
+	sprite->changed = 1;
+	sprite->drawn.x = 0;
+	sprite->drawn.y = 0;
+	sprite->drawn.w = 0;
+	sprite->drawn.h = 0;
+}
+
+uint8_t ssd1306_sprite_add(ssd1306_sprite_list_t* list, ssd1306_sprite_t* sprite)
+{
+	uint8_t i;
+
+	if (list->count >= SSD1306_SPRITES)
+	{
+		return 0;
+	}
+
+	/* Keep the list sorted by z */
+	for (i = list->count; (i > 0) && (list->sprites[i - 1]->z > sprite->z); i--)
+	{
+		list->sprites[i] = list->sprites[i - 1];
+	}
+	list->sprites[i] = sprite;
+	list->count++;
+	sprite->changed = 1;
+
+	return 1;
+}
+
+void ssd1306_sprite_set_bitmap(ssd1306_sprite_t* sprite, const uint8_t* bitmap, const uint8_t* mask)
+{
+	sprite->bitmap = bitmap;
+	sprite->mask = mask;
+	sprite->changed = 1;
+}
+
+void ssd1306_sprite_damage(ssd1306_sprite_list_t* list, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	ssd1306_damage_add(list->damage, &list->damaged, SSD1306_SPRITE_DAMAGE, x, y, w, h);
+}
+
+uint8_t ssd1306_sprite_update(ssd1306_sprite_list_t* list)
+{
+	const ssd1306_canvas_t* screen = ssd1306_get_screen();
+	ssd1306_sprite_t* sprite;
+	const ssd1306_rect_t* rect;
+	uint64_t rows, covered, column;
+	ssd1306_rect_t now;
+	uint8_t d, i, count;
+	int16_t x, sx;
+
+	/* Columns hold 64 rows, portrait screens are left alone until rotated back */
+	if (screen->width < screen->height)
+	{
+		return 0;
+	}
+
+	/* Old and new area of every sprite that changed */
+	for (i = 0; i < list->count; i++)
+	{
+		sprite = list->sprites[i];
+		now.x = sprite->x;
+		now.y = sprite->y;
+		now.w = sprite->visible ? sprite->w : 0;
+		now.h = sprite->visible ? sprite->h : 0;
+		if (sprite->changed || (now.x != sprite->drawn.x) || (now.y != sprite->drawn.y) ||
+			(now.w != sprite->drawn.w) || (now.h != sprite->drawn.h))
+		{
+			ssd1306_sprite_damage(list, sprite->drawn.x, sprite->drawn.y, sprite->drawn.w, sprite->drawn.h);
+			ssd1306_sprite_damage(list, now.x, now.y, now.w, now.h);
+			sprite->drawn = now;
+			sprite->changed = 0;
+		}
+	}
+
+	/* Without internal RAM there is nothing to composite into */
+	if (screen->buffer == NULL)
+	{
+		list->damaged = 0;
+	}
+
+	for (d = 0; d < list->damaged; d++)
+	{
+		rect = &list->damage[d];
+		rows = ssd1306_damage_rows(rect->y, rect->h);
+
+		for (x = rect->x; x < rect->x + rect->w; x++)
+		{
+			/* Background, then every sprite over it from the lowest z */
+			column = 0;
+			if (list->background != NULL)
+			{
+				column = ssd1306_damage_column(list->background->buffer, list->background->stride, list->background->height, x, 0);
+			}
+			for (i = 0; i < list->count; i++)
+			{
+				sprite = list->sprites[i];
+				sx = x - sprite->x;
+				if (!sprite->visible || (sx < 0) || (sx >= sprite->w))
+				{
+					continue;
+				}
+				covered = ssd1306_damage_rows(sprite->y, sprite->h) & rows;
+				if (covered != 0)
+				{
+					column = ssd1306_damage_blend(column, covered, sprite->bitmap, sprite->mask, sprite->w, sprite->h, sx, -sprite->y);
+				}
+			}
+
+			ssd1306_damage_store(rect, x, column);
+		}
+
+		ssd1306_update_area(rect->x, rect->y, rect->w, rect->h);
+	}
+
+	count = list->damaged;
+	list->damaged = 0;
+
+	return count;
+}
+
+uint8_t ssd1306_sprite_collide(const ssd1306_sprite_t* a, const ssd1306_sprite_t* b)
+{
+	int16_t left, right, top, bottom, x, y;
+	uint64_t rows, column_a, column_b;
+
+	/* Common box */
+	left = MAX(a->x, b->x);
+	right = MIN(a->x + a->w, b->x + b->w);
+	top = MAX(a->y, b->y);
+	bottom = MIN(a->y + a->h, b->y + b->h);
+
+	/* Common columns are ANDed 64 rows at a time */
+	for (y = top; y < bottom; y += 64)
+	{
+		rows = ssd1306_damage_rows(0, MIN(bottom - y, 64));
+		for (x = left; x < right; x++)
+		{
+			/* Without a mask every pixel of the box counts */
+			column_a = (a->mask != NULL) ? ssd1306_damage_column(a->mask, a->w, a->h, x - a->x, y - a->y) : ~(uint64_t)0;
+			column_b = (b->mask != NULL) ? ssd1306_damage_column(b->mask, b->w, b->h, x - b->x, y - b->y) : ~(uint64_t)0;
+			if (column_a & column_b & rows)
+			{
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_textfield.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_textfield.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_textfield_init(ssd1306_textfield_t* field, uint16_t x, uint16_t y, const FontPageDef_t* Font, ssd1306_color_t color)
+{
+	field->Font = Font;
+	field->x = x;
+	field->y = y;
+	field->color = color;
+	field->width = 0;
+	field->length = 0;
+	field->valid = 0;
+}
+
+void ssd1306_textfield_invalidate(ssd1306_textfield_t* field)
+{
+	field->valid = 0;
+}
+
+uint8_t ssd1306_textfield_set(ssd1306_textfield_t* field, const char* str)
+{
+	const FontPageDef_t* Font = field->Font;
+	ssd1306_text_mode_t mode = ssd1306_get_text_mode();
+	uint16_t x = field->x, start = 0, end = 0;
+	uint8_t i = 0, drawn = 0, moved = !field->valid;
+	uint8_t advance;
+	int32_t glyph, old;
+	uint16_t ch;
+
+	/* Cells are overwritten, so their background must be drawn */
+	ssd1306_set_text_mode(ssd1306_text_opaque);
+
+	while ((i < SSD1306_TEXTFIELD_LENGTH) && ((ch = FONTS_DecodeUTF8(&str)) != 0))
+	{
+		/* Check character is part of font and fits in LCD */
+		glyph = FONTS_GetGlyphIndex(Font, ch);
+		if (glyph < 0)
+		{
+			break;
+		}
+		advance = FONTS_GetGlyphAdvance(Font, glyph);
+		if ((x + advance) > ssd1306_get_screen()->width)
+		{
+			break;
+		}
+
+		if (moved || (i >= field->length) || (field->text[i] != ch))
+		{
+			/* Glyphs after one of different width are moved */
+			old = (i < field->length) ? FONTS_GetGlyphIndex(Font, field->text[i]) : -1;
+			if ((old < 0) || (FONTS_GetGlyphAdvance(Font, old) != advance))
+			{
+				moved = 1;
+			}
+
+			ssd1306_goto_xy(x, field->y);
+			ssd1306_putc_unicode(ch, Font, field->color);
+			field->text[i] = ch;
+			drawn++;
+
+			/* Changed glyphs next to each other are sent together */
+			if (end != x)
+			{
+				ssd1306_update_area(start, field->y, end - start, Font->FontHeight);
+				start = x;
+			}
+			end = x + advance;
+		}
+
+		x += advance;
+		i++;
+	}
+
+	/* Clear what is left of a longer text */
+	if (field->valid && (field->x + field->width > x))
+	{
+		ssd1306_draw_filled_rectangle(x, field->y, field->x + field->width - x - 1, Font->FontHeight - 1,
+				(ssd1306_color_t)!field->color);
+		if (end != x)
+		{
+			ssd1306_update_area(start, field->y, end - start, Font->FontHeight);
+			start = x;
+		}
+		end = field->x + field->width;
+	}
+	ssd1306_update_area(start, field->y, end - start, Font->FontHeight);
+
+	field->width = x - field->x;
+	field->length = i;
+	field->valid = 1;
+
+	ssd1306_set_text_mode(mode);
+
+	return drawn;
+}
@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_tilemap.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_tilemap.h"
+#include "ssd1306_hal.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_tilemap_init(ssd1306_tilemap_t* map, const uint8_t* tiles, uint8_t tile)
+{
+	map->tiles = tiles;
+	memset(map->map, tile, sizeof(map->map));
+	ssd1306_tilemap_invalidate(map);
+}
+
+void ssd1306_tilemap_set(ssd1306_tilemap_t* map, uint8_t column, uint8_t row, uint8_t tile)
+{
+	/* Check input parameters */
+	if ((column >= SSD1306_TILEMAP_COLUMNS) || (row >= SSD1306_TILEMAP_ROWS))
+	{
+		return;
+	}
+
+	if (map->map[row][column] != tile)
+	{
+		map->map[row][column] = tile;
+		map->dirty[row] |= 1 << column;
+	}
+}
+
+uint8_t ssd1306_tilemap_puts(ssd1306_tilemap_t* map, uint8_t column, uint8_t row, const char* str, uint8_t first)
+{
+	uint8_t count = 0;
+
+	while ((*str != 0) && (column < SSD1306_TILEMAP_COLUMNS))
+	{
+		ssd1306_tilemap_set(map, column++, row, (uint8_t)*str++ - first);
+		count++;
+	}
+
+	return count;
+}
+
+void ssd1306_tilemap_invalidate(ssd1306_tilemap_t* map)
+{
+	uint8_t row;
+
+	for (row = 0; row < SSD1306_TILEMAP_ROWS; row++)
+	{
+		map->dirty[row] = (uint16_t)((1UL << SSD1306_TILEMAP_COLUMNS) - 1);
+	}
+}
+
+uint16_t ssd1306_tilemap_flush(ssd1306_tilemap_t* map)
+{
+	uint8_t chunk[SSD1306_TILEMAP_CHUNK * 8];
+	uint8_t row, column, end, n;
+	uint16_t bits, count = 0;
+
+	/* Tiles are landscape pages, dirty cells wait until the screen is rotated back */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return 0;
+	}
+
+	for (row = 0; row < SSD1306_TILEMAP_ROWS; row++)
+	{
+		bits = map->dirty[row];
+		map->dirty[row] = 0;
+		column = 0;
+
+		while (bits != 0)
+		{
+			/* Next run of dirty cells */
+			while (!(bits & (1 << column)))
+			{
+				column++;
+			}
+			for (end = column; (end < SSD1306_TILEMAP_COLUMNS) && (bits & (1 << end)); end++)
+			{
+				bits &= ~(1 << end);
+			}
+
+			ssd1306_i2c_command(0xB0 + row);
+			ssd1306_i2c_command(0x00 | ((column * 8) & 0x0F));
+			ssd1306_i2c_command(0x10 | ((column * 8) >> 4));
+
+			/* Tiles go out in small chunks, the column address advances by itself */
+			count += end - column;
+			while (column < end)
+			{
+				for (n = 0; (n < SSD1306_TILEMAP_CHUNK) && (column < end); n++, column++)
+				{
+					memcpy(&chunk[n * 8], &map->tiles[map->map[row][column] * 8], 8);
+				}
+				ssd1306_i2c_write_multi(0x40, chunk, n * 8);
+			}
+		}
+	}
+
+	return count;
+}
@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_viewport.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_viewport.h"
+#include "ssd1306_hal.h"
+
+/* Private includes ----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SSD1306_VIEWPORT_PAGES      (SSD1306_HEIGHT / 8)
+#define SSD1306_VIEWPORT_ALL_PAGES  ((1 << SSD1306_VIEWPORT_PAGES) - 1)
+
+/* Private macro -------------------------------------------------------------*/
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t ssd1306_viewport_rows(const ssd1306_viewport_t* vp, int16_t y, int16_t h);
+static uint8_t ssd1306_viewport_send(const ssd1306_viewport_t* vp, uint8_t pages, int16_t column, int16_t w);
+static uint8_t ssd1306_viewport_byte(const ssd1306_canvas_t* canvas, int16_t x, int16_t row);
+
+/* Private user code ---------------------------------------------------------*/
+
+void ssd1306_viewport_init(ssd1306_viewport_t* vp, const ssd1306_canvas_t* canvas)
+{
+	vp->canvas = canvas;
+	vp->x = 0;
+	vp->y = 0;
+	vp->start_line = 0;
+	vp->shown = 0;
+}
+
+uint8_t ssd1306_viewport_flush(ssd1306_viewport_t* vp)
+{
+	/* Window is made of landscape pages, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return 0;
+	}
+
+	vp->shown = 1;
+	ssd1306_set_start_line(vp->start_line);
+
+	return ssd1306_viewport_send(vp, SSD1306_VIEWPORT_ALL_PAGES, 0, SSD1306_WIDTH);
+}
+
+uint8_t ssd1306_viewport_move(ssd1306_viewport_t* vp, int16_t x, int16_t y)
+{
+	int16_t dy;
+	uint8_t pages;
+
+	/* Window is made of landscape pages, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return 0;
+	}
+
+	/* Keep the window inside the canvas */
+	x = MAX(MIN(x, (int16_t)vp->canvas->width - SSD1306_WIDTH), 0);
+	y = MAX(MIN(y, (int16_t)vp->canvas->height - SSD1306_HEIGHT), 0);
+	dy = y - vp->y;
+
+	/* Columns can not be moved inside GDDRAM, nor can a whole screen */
+	if (!vp->shown || (x != vp->x) || (dy <= -SSD1306_HEIGHT) || (dy >= SSD1306_HEIGHT))
+	{
+		vp->x = x;
+		vp->y = y;
+		return ssd1306_viewport_flush(vp);
+	}
+	if (dy == 0)
+	{
+		return 0;
+	}
+
+	/* Rows kept on screen stay in their GDDRAM rows, the start line follows them */
+	vp->start_line = (vp->start_line + dy) & (SSD1306_HEIGHT - 1);
+	vp->y = y;
+
+	/* Only GDDRAM pages holding the rows scrolled into view are written */
+	pages = (dy > 0) ? ssd1306_viewport_rows(vp, y + SSD1306_HEIGHT - dy, dy) : ssd1306_viewport_rows(vp, y, -dy);
+	pages = ssd1306_viewport_send(vp, pages, 0, SSD1306_WIDTH);
+
+	ssd1306_set_start_line(vp->start_line);
+
+	return pages;
+}
+
+uint8_t ssd1306_viewport_scroll(ssd1306_viewport_t* vp, int16_t dx, int16_t dy)
+{
+	return ssd1306_viewport_move(vp, vp->x + dx, vp->y + dy);
+}
+
+uint8_t ssd1306_viewport_update_area(ssd1306_viewport_t* vp, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	int16_t right, bottom;
+
+	/* Window is made of landscape pages, portrait screens are left alone */
+	if (ssd1306_get_screen()->width < ssd1306_get_screen()->height)
+	{
+		return 0;
+	}
+
+	/* Clip to the window */
+	right = MIN(x + w, vp->x + SSD1306_WIDTH);
+	bottom = MIN(y + h, vp->y + SSD1306_HEIGHT);
+	x = MAX(x, vp->x);
+	y = MAX(y, vp->y);
+	if (!vp->shown || (x >= right) || (y >= bottom))
+	{
+		return 0;
+	}
+
+	return ssd1306_viewport_send(vp, ssd1306_viewport_rows(vp, y, bottom - y), x - vp->x, right - x);
+}
+
+void ssd1306_viewport_close(ssd1306_viewport_t* vp)
+{
+	vp->start_line = 0;
+	vp->shown = 0;
+	ssd1306_set_start_line(0);
+}
+
+static uint8_t ssd1306_viewport_rows(const ssd1306_viewport_t* vp, int16_t y, int16_t h)
+{
+	uint8_t pages = 0;
+	uint8_t line;
+
+	/* GDDRAM pages holding canvas rows y to y + h - 1 of the window */
+	for (; h > 0; h--, y++)
+	{
+		line = (vp->start_line + (y - vp->y)) & (SSD1306_HEIGHT - 1);
+		pages |= 1 << (line / 8);
+	}
+
+	return pages;
+}
+
+static uint8_t ssd1306_viewport_send(const ssd1306_viewport_t* vp, uint8_t pages, int16_t column, int16_t w)
+{
+	const ssd1306_canvas_t* canvas = vp->canvas;
+	uint8_t chunk[SSD1306_VIEWPORT_CHUNK];
+	uint8_t page, offset, mask, count = 0;
+	int16_t row, x, i, n;
+
+	for (page = 0; page < SSD1306_VIEWPORT_PAGES; page++)
+	{
+		if (!(pages & (1 << page)))
+		{
+			continue;
+		}
+		count++;
+
+		/* Window row shown by bit 0 of this GDDRAM page, rows past the bottom wrap to the top */
+		offset = (page * 8 - vp->start_line) & (SSD1306_HEIGHT - 1);
+		row = vp->y + offset;
+		mask = (offset <= (SSD1306_HEIGHT - 8)) ? 0xFF : (0xFF >> (offset - (SSD1306_HEIGHT - 8)));
+		x = vp->x + column;
+
+		ssd1306_i2c_command(0xB0 + page);
+		ssd1306_i2c_command(0x00 | (column & 0x0F));
+		ssd1306_i2c_command(0x10 | (column >> 4));
+
+		if ((mask == 0xFF) && ((row % 8) == 0) && ((row + 8) <= canvas->height) && ((x + w) <= canvas->width))
+		{
+			/* Aligned pages go out straight from the canvas */
+			ssd1306_i2c_write_multi(0x40, &canvas->buffer[(row / 8) * canvas->stride + x], w);
+			continue;
+		}
+
+		/* Shifted pages are composed in small chunks, the column address advances by itself */
+		for (i = 0; i < w; i += n)
+		{
+			n = MIN(w - i, SSD1306_VIEWPORT_CHUNK);
+			for (x = 0; x < n; x++)
+			{
+				chunk[x] = (ssd1306_viewport_byte(canvas, vp->x + column + i + x, row) & mask) |
+				           (ssd1306_viewport_byte(canvas, vp->x + column + i + x, row - SSD1306_HEIGHT) & ~mask);
+			}
+			ssd1306_i2c_write_multi(0x40, chunk, n);
+		}
+	}
+
+	return count;
+}
+
+static uint8_t ssd1306_viewport_byte(const ssd1306_canvas_t* canvas, int16_t x, int16_t row)
+{
+	int16_t page = (row >= 0) ? (row / 8) : -((7 - row) / 8);
+	uint8_t shift = row - page * 8;
+	uint8_t value = 0;
+
+	/* Eight rows of a column starting at any row, black outside the canvas */
+	if ((x < 0) || (x >= canvas->width) || (row <= -8) || (row >= (int16_t)canvas->height))
+	{
+		return 0;
+	}
+	if (page >= 0)
+	{
+		value = canvas->buffer[page * canvas->stride + x] >> shift;
+	}
+	if ((shift != 0) && ((page + 1) < FONTS_PAGES(canvas->height)))
+	{
+		value |= canvas->buffer[(page + 1) * canvas->stride + x] << (8 - shift);
+	}
+	if ((row + 8) > canvas->height)
+	{
+		value &= 0xFF >> ((row + 8) - canvas->height);
+	}
+
+	return value;
+}
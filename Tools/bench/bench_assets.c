@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @file    bench_assets.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Decode time against flash usage of the font and bitmap formats, scaled text,
+ * and width and drawing time of a string with monospace and proportional fonts.
+ * Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_assets.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/fonts*.c \
+ *       -o bench_assets && ./bench_assets
+ *
+ * Absolute times are host numbers, use them only to compare formats.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_hal.h"
+#include "logo.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (2000)
+#define BENCH_GLYPHS        (FONTS_LAST_CHAR - FONTS_FIRST_CHAR + 1)
+#define BENCH_TEXT          "Temp 21.5C"
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t page_data[3][FONTS_PAGE_DATA_SIZE(16, 26)];
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Size of a run-length encoded stream producing size bytes */
+static uint32_t bench_rle_length(const uint8_t* src, uint32_t size)
+{
+	const uint8_t* start = src;
+	uint32_t out = 0;
+
+	while (out < size)
+	{
+		if (*src & 0x80)
+		{
+			out += (*src & 0x7F) + 2;
+			src += 2;
+		}
+		else
+		{
+			out += *src + 1;
+			src += *src + 2;
+		}
+	}
+	return src - start;
+}
+
+/* Flash used by glyph data and index table */
+static uint32_t bench_font_size(const FontPageDef_t* Font)
+{
+	uint32_t glyphs = Font->LastChar - Font->FirstChar + 1;
+	uint32_t cell = Font->FontWidth * FONTS_PAGES(Font->FontHeight);
+	const uint8_t* last;
+
+	if (Font->Format == FONTS_FORMAT_PAGE)
+	{
+		return glyphs * cell;
+	}
+
+	last = &Font->data[Font->Index[glyphs - 1]];
+	if (Font->Format == FONTS_FORMAT_PACKED)
+	{
+		return Font->Index[glyphs - 1] + 3 + (((last[2] & 0x0F) + 1) * last[1] + 7) / 8 + glyphs * 2;
+	}
+	return Font->Index[glyphs - 1] + bench_rle_length(last, cell) + glyphs * 2;
+}
+
+static double bench_legacy(FontDef_t* Font)
+{
+	double start = bench_now();
+	int r, c;
+
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		for (c = FONTS_FIRST_CHAR; c <= FONTS_LAST_CHAR; c++)
+		{
+			ssd1306_goto_xy(r & 63, 1 + (c & 7));
+			ssd1306_putc(c, Font, ssd1306_color_white);
+		}
+	}
+	return (bench_now() - start) / (BENCH_ROUNDS * BENCH_GLYPHS);
+}
+
+static double bench_page(const FontPageDef_t* Font)
+{
+	double start = bench_now();
+	int r, c;
+
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		for (c = FONTS_FIRST_CHAR; c <= FONTS_LAST_CHAR; c++)
+		{
+			ssd1306_goto_xy(r & 63, 1 + (c & 7));
+			ssd1306_putc_page(c, Font, ssd1306_color_white);
+		}
+	}
+	return (bench_now() - start) / (BENCH_ROUNDS * BENCH_GLYPHS);
+}
+
+static double bench_scaled(FontDef_t* Font, uint8_t scale)
+{
+	double start = bench_now();
+	int r, c;
+
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		for (c = FONTS_FIRST_CHAR; c <= FONTS_LAST_CHAR; c++)
+		{
+			ssd1306_goto_xy(r & 63, 1 + (c & 7));
+			ssd1306_putc_scaled(c, Font, scale, ssd1306_color_white);
+		}
+	}
+	return (bench_now() - start) / (BENCH_ROUNDS * BENCH_GLYPHS);
+}
+
+static double bench_string(const FontPageDef_t* Font)
+{
+	double start = bench_now();
+	int r;
+
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_goto_xy(0, 1 + (r & 7));
+		ssd1306_puts_page(BENCH_TEXT, Font, ssd1306_color_white);
+	}
+	return (bench_now() - start) / BENCH_ROUNDS;
+}
+
+int main(void)
+{
+	FontDef_t* legacy[3] = { &Font_7x10, &Font_11x18, &Font_16x26 };
+	FontPageDef_t* packed[3] = { &Font_7x10_Packed, &Font_11x18_Packed, &Font_16x26_Packed };
+	FontPageDef_t* rle[3] = { &Font_7x10_Rle, &Font_11x18_Rle, &Font_16x26_Rle };
+	FontPageDef_t* prop[3] = { &Font_7x10_Prop, &Font_11x18_Prop, &Font_16x26_Prop };
+	FontPageDef_t page;
+	double start, raw_ns, rle_ns;
+	int i, r;
+
+	ssd1306_init();
+
+	printf("%-10s %-7s %8s %10s\n", "font", "format", "flash", "ns/glyph");
+	for (i = 0; i < 3; i++)
+	{
+		FONTS_ConvertToPage(legacy[i], page_data[i], sizeof(page_data[i]), &page);
+
+		printf("%-10s %-7s %8u %10.1f\n", "", "uint16",
+				(unsigned)(BENCH_GLYPHS * legacy[i]->FontHeight * 2), bench_legacy(legacy[i]));
+		printf("%2ux%-7u %-7s %8u %10.1f\n", legacy[i]->FontWidth, legacy[i]->FontHeight, "page",
+				(unsigned)bench_font_size(&page), bench_page(&page));
+		printf("%-10s %-7s %8u %10.1f\n", "", "packed",
+				(unsigned)bench_font_size(packed[i]), bench_page(packed[i]));
+		printf("%-10s %-7s %8u %10.1f\n", "", "rle",
+				(unsigned)bench_font_size(rle[i]), bench_page(rle[i]));
+	}
+
+	printf("\n%-10s %-7s %8s %10s\n", "scaled", "size", "flash", "ns/glyph");
+	for (i = 2; i <= 4; i++)
+	{
+		printf("7x10 x%-5d %2ux%-4u %8s %10.1f\n", i, 7 * i, 10 * i, "-", bench_scaled(&Font_7x10, i));
+	}
+
+	printf("\n%-10s %-7s %8s %10s\n", "string", "", "pixels", "ns/string");
+	for (i = 0; i < 2; i++)
+	{
+		FONTS_ConvertToPage(legacy[i], page_data[i], sizeof(page_data[i]), &page);
+		printf("%2ux%-7u %-7s %8u %10.1f\n", legacy[i]->FontWidth, legacy[i]->FontHeight, "page",
+				FONTS_GetStringWidth(BENCH_TEXT, &page), bench_string(&page));
+		printf("%-10s %-7s %8u %10.1f\n", "", "prop",
+				FONTS_GetStringWidth(BENCH_TEXT, prop[i]), bench_string(prop[i]));
+	}
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_draw_bitmap(35, 2 + (r & 1), logo, LOGO_WIDTH, LOGO_HEIGHT, ssd1306_color_black);
+	}
+	raw_ns = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_draw_bitmap_rle(35, 2 + (r & 1), logo_rle, LOGO_WIDTH, LOGO_HEIGHT, ssd1306_color_black);
+	}
+	rle_ns = (bench_now() - start) / BENCH_ROUNDS;
+
+	printf("\n%-10s %-7s %8s %10s\n", "bitmap", "format", "flash", "ns/draw");
+	printf("%-10s %-7s %8u %10.1f\n", "logo", "raw", (unsigned)sizeof(logo), raw_ns);
+	printf("%-10s %-7s %8u %10.1f\n", "", "rle", (unsigned)sizeof(logo_rle), rle_ns);
+
+	return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ ******************************************************************************
+ * @file    bench_canvas.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Drawing time of a gauge frame: the static dial re-rendered every frame
+ * against the dial rendered once into a canvas and copied. Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_canvas.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/fonts*.c \
+ *       -o bench_canvas && ./bench_canvas
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (10000)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t bench_dial_buffer[64 * 8];
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Static part of the gauge: rim, scale ticks and labels */
+static void bench_dial(void)
+{
+	static const int8_t ticks[9][4] = {
+		{ 4, 32, 9, 32 }, { 9, 16, 13, 19 }, { 20, 5, 23, 10 }, { 32, 1, 32, 6 }, { 44, 5, 41, 10 },
+		{ 55, 16, 51, 19 }, { 60, 32, 55, 32 }, { 55, 48, 51, 45 }, { 9, 48, 13, 45 },
+	};
+	uint8_t i;
+
+	ssd1306_draw_circle(32, 32, 30, ssd1306_color_white);
+	ssd1306_draw_circle(32, 32, 29, ssd1306_color_white);
+	for (i = 0; i < 9; i++)
+	{
+		ssd1306_draw_line(ticks[i][0], ticks[i][1], ticks[i][2], ticks[i][3], ssd1306_color_white);
+	}
+	ssd1306_goto_xy(14, 40);
+	ssd1306_puts_page("0  100", &Font_7x10_Prop, ssd1306_color_white);
+	ssd1306_goto_xy(22, 14);
+	ssd1306_puts_page("kPa", &Font_7x10_Prop, ssd1306_color_white);
+}
+
+int main(void)
+{
+	ssd1306_canvas_t dial;
+	double start, ns;
+	int r;
+
+	ssd1306_init();
+	printf("%-22s %10s\n", "method", "ns/frame");
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_fill(ssd1306_color_black);
+		bench_dial();
+		ssd1306_draw_line(32, 32, 12 + r % 40, 12, ssd1306_color_white);
+	}
+	ns = (bench_now() - start) / BENCH_ROUNDS;
+	printf("%-22s %10.1f\n", "re-render dial", ns);
+
+	ssd1306_canvas_init(&dial, bench_dial_buffer, 64, 64);
+	ssd1306_set_canvas(&dial);
+	ssd1306_fill(ssd1306_color_black);
+	bench_dial();
+	ssd1306_set_canvas(NULL);
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_fill(ssd1306_color_black);
+		ssd1306_draw_canvas(0, 0, &dial);
+		ssd1306_draw_line(32, 32, 12 + r % 40, 12, ssd1306_color_white);
+	}
+	ns = (bench_now() - start) / BENCH_ROUNDS;
+	printf("%-22s %10.1f\n", "canvas copy", ns);
+
+	return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file    bench_columns.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Vertical work on the page-major internal RAM against the column-major
+ * surface: a strip chart moving left with a new sample span each frame, a
+ * ticker moving up one row, and a top to bottom flip. Every frame is sent
+ * to the LCD. Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_columns.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/ssd1306_columns.c \
+ *       Library/ssd1306/src/fonts*.c -o bench_columns && ./bench_columns
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_columns.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (10000)
+
+/* Private variables ---------------------------------------------------------*/
+static ssd1306_columns_t bench_cols;
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint16_t bench_sample(int r)
+{
+	return 32 + (r * 7) % 29 - 14;
+}
+
+static void bench_chart(void)
+{
+	double start, page, cols;
+	int r;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_scroll_region(0, 0, SSD1306_WIDTH, SSD1306_HEIGHT, -1, 0);
+		ssd1306_draw_line(SSD1306_WIDTH - 1, 32, SSD1306_WIDTH - 1, bench_sample(r), ssd1306_color_white);
+		ssd1306_update_area(SSD1306_WIDTH - 1, 0, 1, SSD1306_HEIGHT);
+	}
+	page = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_columns_scroll(&bench_cols, 0, SSD1306_WIDTH, -1, 0, ssd1306_color_black);
+		ssd1306_columns_span(&bench_cols, SSD1306_WIDTH - 1, 32, bench_sample(r), ssd1306_color_white);
+		ssd1306_columns_update(&bench_cols, 0, SSD1306_WIDTH);
+	}
+	cols = (bench_now() - start) / BENCH_ROUNDS;
+
+	printf("%-10s %12.1f %12.1f\n", "chart", page, cols);
+}
+
+static void bench_ticker(void)
+{
+	double start, page, cols;
+	int r;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_scroll_region(0, 0, SSD1306_WIDTH, SSD1306_HEIGHT, 0, -1);
+	}
+	page = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_columns_scroll(&bench_cols, 0, SSD1306_WIDTH, 0, -1, ssd1306_color_black);
+		ssd1306_columns_update(&bench_cols, 0, SSD1306_WIDTH);
+	}
+	cols = (bench_now() - start) / BENCH_ROUNDS;
+
+	printf("%-10s %12.1f %12.1f\n", "ticker", page, cols);
+}
+
+static void bench_flip(void)
+{
+	const ssd1306_canvas_t* screen = ssd1306_get_screen();
+	double start, page, cols;
+	uint16_t x, y;
+	uint8_t top, bottom;
+	int r;
+
+	/* Page-major flip: the pages swap places and every byte is bit reversed */
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		for (y = 0; y < SSD1306_HEIGHT / 16; y++)
+		{
+			for (x = 0; x < SSD1306_WIDTH; x++)
+			{
+				top = screen->buffer[y * SSD1306_WIDTH + x];
+				bottom = screen->buffer[(SSD1306_HEIGHT / 8 - 1 - y) * SSD1306_WIDTH + x];
+				top = (uint8_t)(((top * 0x0802LU & 0x22110LU) | (top * 0x8020LU & 0x88440LU)) * 0x10101LU >> 16);
+				bottom = (uint8_t)(((bottom * 0x0802LU & 0x22110LU) | (bottom * 0x8020LU & 0x88440LU)) * 0x10101LU >> 16);
+				screen->buffer[y * SSD1306_WIDTH + x] = bottom;
+				screen->buffer[(SSD1306_HEIGHT / 8 - 1 - y) * SSD1306_WIDTH + x] = top;
+			}
+		}
+		ssd1306_update_screen();
+	}
+	page = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_columns_flip(&bench_cols, 0, SSD1306_WIDTH);
+		ssd1306_columns_update(&bench_cols, 0, SSD1306_WIDTH);
+	}
+	cols = (bench_now() - start) / BENCH_ROUNDS;
+
+	printf("%-10s %12.1f %12.1f\n", "flip", page, cols);
+}
+
+int main(void)
+{
+	ssd1306_init();
+	ssd1306_columns_fill(&bench_cols, ssd1306_color_black);
+	printf("%-10s %12s %12s\n", "frame", "page ns", "columns ns");
+
+	bench_chart();
+	bench_ticker();
+	bench_flip();
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ ******************************************************************************
+ * @file    bench_dither.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Frames per second of the grayscale to 1bpp conversions at the size of one
+ * panel and of logical displays made of 2 and 4 panels. Host build, add
+ * -mavx2 for the AVX2 kernel or -DSSD1306_DITHER_SIMD=0 for the portable code:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_dither.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/ssd1306_dither.c \
+ *       Library/ssd1306/src/fonts*.c -o bench_dither && ./bench_dither
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_dither.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (2000)
+#define BENCH_WIDTH         (512)
+#define BENCH_HEIGHT        (128)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t bench_gray[BENCH_WIDTH * BENCH_HEIGHT];
+static uint8_t bench_buffer[BENCH_WIDTH * BENCH_HEIGHT / 8];
+static int16_t bench_errors[SSD1306_DITHER_ERRORS(BENCH_WIDTH)];
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double bench_fps(int method, const ssd1306_canvas_t* canvas)
+{
+	double start;
+	int r;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		if (method == 0)
+		{
+			ssd1306_dither_ordered(canvas, bench_gray, canvas->width, canvas->height, BENCH_WIDTH);
+		}
+		else if (method == 1)
+		{
+			ssd1306_dither_floyd(canvas, bench_gray, canvas->width, canvas->height, BENCH_WIDTH, bench_errors);
+		}
+		else
+		{
+			ssd1306_dither_atkinson(canvas, bench_gray, canvas->width, canvas->height, BENCH_WIDTH, bench_errors);
+		}
+	}
+
+	return 1e9 * BENCH_ROUNDS / (bench_now() - start);
+}
+
+static void bench_size(uint16_t w, uint16_t h)
+{
+	ssd1306_canvas_t canvas;
+	char name[16];
+
+	ssd1306_canvas_init(&canvas, bench_buffer, w, h);
+	snprintf(name, sizeof(name), "%ux%u", w, h);
+	printf("%-10s %12.0f %12.0f %12.0f\n", name, bench_fps(0, &canvas), bench_fps(1, &canvas), bench_fps(2, &canvas));
+}
+
+int main(void)
+{
+	int x, y;
+
+	/* Diagonal gradient with a fine texture, like a photo */
+	for (y = 0; y < BENCH_HEIGHT; y++)
+	{
+		for (x = 0; x < BENCH_WIDTH; x++)
+		{
+			bench_gray[y * BENCH_WIDTH + x] = (uint8_t)((x + y * 2) / 3 + ((x * 7 + y * 13) % 17));
+		}
+	}
+
+#if SSD1306_DITHER_SIMD && defined(__AVX2__)
+	printf("kernel: AVX2\n");
+#elif SSD1306_DITHER_SIMD && defined(__SSE2__)
+	printf("kernel: SSE2\n");
+#else
+	printf("kernel: portable\n");
+#endif
+	printf("%-10s %12s %12s %12s\n", "size", "ordered fps", "floyd fps", "atkinson fps");
+
+	bench_size(128, 64);
+	bench_size(256, 64);
+	bench_size(512, 64);
+	bench_size(256, 128);
+
+	return 0;
+}
@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ * @file    bench_hal.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Host port used by the benchmarks. Nothing is sent anywhere, written bytes
+ * are only counted so bus traffic can be compared.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_hal.h"
+
+/* Private variables ---------------------------------------------------------*/
+uint32_t bench_i2c_bytes;
+
+/* Private user code ---------------------------------------------------------*/
+
+uint8_t ssd1306_i2c_init(void)
+{
+	return 1;
+}
+
+void ssd1306_i2c_write(uint8_t reg, uint8_t data)
+{
+	(void)reg;
+	(void)data;
+	bench_i2c_bytes += 2;
+}
+
+void ssd1306_i2c_write_multi(uint8_t reg, uint8_t *data, uint16_t count)
+{
+	(void)reg;
+	(void)data;
+	bench_i2c_bytes += count + 1;
+}
+
+void ssd1306_i2c_command(uint8_t cmd)
+{
+	ssd1306_i2c_write(0x00, cmd);
+}
+
+void ssd1306_i2c_data(uint8_t data)
+{
+	ssd1306_i2c_write(0x40, data);
+}
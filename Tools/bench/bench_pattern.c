@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ * @file    bench_pattern.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Cost of a shaded 100x40 bar: a checkerboard drawn pixel by pixel, against
+ * solid and patterned filled rectangles and circles. Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_pattern.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/fonts*.c \
+ *       -o bench_pattern && ./bench_pattern
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (10000)
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_pixels(void)
+{
+	double start;
+	uint16_t x, y;
+	int r;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		for (y = 11; y <= 51; y++)
+		{
+			for (x = 13; x <= 113; x++)
+			{
+				ssd1306_draw_pixel(x, y, (ssd1306_color_t)((x + y) & 1));
+			}
+		}
+	}
+
+	printf("%-24s %10.1f\n", "checker pixels", (bench_now() - start) / BENCH_ROUNDS);
+}
+
+static void bench_fill(const char* name, const ssd1306_pattern_t* pattern, ssd1306_text_mode_t mode)
+{
+	double start, rectangle, circle;
+	int r;
+
+	ssd1306_set_pattern(pattern, mode);
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_draw_filled_rectangle(13, 11, 100, 40, ssd1306_color_white);
+	}
+	rectangle = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_draw_filled_circle(64, 32, 28, ssd1306_color_white);
+	}
+	circle = (bench_now() - start) / BENCH_ROUNDS;
+
+	ssd1306_set_pattern(NULL, ssd1306_text_opaque);
+	printf("%-24s %10.1f %10.1f\n", name, rectangle, circle);
+}
+
+int main(void)
+{
+	ssd1306_pattern_t gray;
+
+	ssd1306_init();
+	ssd1306_pattern_gray(&gray, 24);
+	printf("%-24s %10s %10s\n", "fill", "rect ns", "circle ns");
+
+	bench_pixels();
+	bench_fill("solid", NULL, ssd1306_text_opaque);
+	bench_fill("checker opaque", &ssd1306_pattern_checker, ssd1306_text_opaque);
+	bench_fill("bayer 24/64 opaque", &gray, ssd1306_text_opaque);
+	bench_fill("bayer 24/64 transparent", &gray, ssd1306_text_transparent);
+
+	return 0;
+}
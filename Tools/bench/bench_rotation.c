@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * @file    bench_rotation.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Cost of the orientations: drawing plus update of a frame in landscape,
+ * upside down and portrait, where every update transposes 8x8 blocks. Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_rotation.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/fonts*.c \
+ *       -o bench_rotation && ./bench_rotation
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (10000)
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_rotation(const char* name, ssd1306_rotation_t rotation)
+{
+	const ssd1306_canvas_t* screen;
+	double start, draw, update;
+	int r;
+
+	ssd1306_set_rotation(rotation);
+	screen = ssd1306_get_screen();
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_fill(ssd1306_color_black);
+		ssd1306_draw_rectangle(0, 0, screen->width - 1, screen->height - 1, ssd1306_color_white);
+		ssd1306_draw_line(0, 0, screen->width - 1, r % screen->height, ssd1306_color_white);
+		ssd1306_goto_xy(2, 2);
+		ssd1306_puts_page("12:34", &Font_11x18_Packed, ssd1306_color_white);
+	}
+	draw = (bench_now() - start) / BENCH_ROUNDS;
+
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_update_screen();
+	}
+	update = (bench_now() - start) / BENCH_ROUNDS;
+
+	printf("%-10s %10.1f %12.1f\n", name, draw, update);
+}
+
+int main(void)
+{
+	ssd1306_init();
+	printf("%-10s %10s %12s\n", "rotation", "draw ns", "update ns");
+
+	bench_rotation("0", ssd1306_rotation_0);
+	bench_rotation("180", ssd1306_rotation_180);
+	bench_rotation("90", ssd1306_rotation_90);
+	bench_rotation("270", ssd1306_rotation_270);
+
+	return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ ******************************************************************************
+ * @file    bench_textfield.c
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo source.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Bus bytes and drawing time of a numeric readout: snprintf, ssd1306_puts_page
+ * and ssd1306_update_screen against a text field. Host build:
+ *
+ *   gcc -O2 -ITools/bench -ILibrary/ssd1306/inc Tools/bench/bench_textfield.c \
+ *       Tools/bench/bench_hal.c Library/ssd1306/src/ssd1306.c Library/ssd1306/src/ssd1306_textfield.c \
+ *       Library/ssd1306/src/ssd1306_format.c Library/ssd1306/src/fonts*.c -o bench_textfield && ./bench_textfield
+ *
+ * Absolute times are host numbers, use them only to compare methods.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_hal.h"
+#include "ssd1306_format.h"
+#include "ssd1306_textfield.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_ROUNDS        (10000)
+
+/* Private user code ---------------------------------------------------------*/
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Slowly rising reading, as a sensor sampled at 10-50 Hz */
+static int32_t bench_value(int r)
+{
+	return 2000 + r / 3;
+}
+
+int main(void)
+{
+	ssd1306_textfield_t field;
+	char buf[SSD1306_FORMAT_SIZE];
+	double start, ns;
+	int r;
+
+	ssd1306_init();
+	printf("%-22s %10s %10s\n", "method", "bytes/upd", "ns/upd");
+
+	bench_i2c_bytes = 0;
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		snprintf(buf, sizeof(buf), "%3ld.%02ld", (long)(bench_value(r) / 100), (long)(bench_value(r) % 100));
+		ssd1306_goto_xy(10, 20);
+		ssd1306_puts_page(buf, &Font_11x18_Rle, ssd1306_color_white);
+		ssd1306_update_screen();
+	}
+	ns = (bench_now() - start) / BENCH_ROUNDS;
+	printf("%-22s %10.1f %10.1f\n", "snprintf + full frame", (double)bench_i2c_bytes / BENCH_ROUNDS, ns);
+
+	ssd1306_textfield_init(&field, 10, 20, &Font_11x18_Rle, ssd1306_color_white);
+	bench_i2c_bytes = 0;
+	start = bench_now();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		ssd1306_format_fixed(buf, bench_value(r), 2, 6, ' ');
+		ssd1306_textfield_set(&field, buf);
+	}
+	ns = (bench_now() - start) / BENCH_ROUNDS;
+	printf("%-22s %10.1f %10.1f\n", "format + text field", (double)bench_i2c_bytes / BENCH_ROUNDS, ns);
+
+	return 0;
+}
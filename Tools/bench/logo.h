@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * @file    logo.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Example logo in raw and RLE form. Regenerate the RLE array with:
+ *   python3 Tools/rletool.py Examples/esp32/main/main.c --name logo --width 57 --height 60
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BENCH_LOGO_H
+#define _BENCH_LOGO_H
+
+#define LOGO_WIDTH   (57)
+#define LOGO_HEIGHT  (60)
+
+// 'logo', 57x60px, copied from Examples/esp32/main/main.c
+const unsigned char logo [] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff, 0x80, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80,
+	0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xdf, 0xff, 0x80,
+	0xff, 0xf0, 0x00, 0x00, 0x07, 0xc7, 0xff, 0x80, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xc3, 0xff, 0x80,
+	0xff, 0x80, 0x00, 0x00, 0x07, 0xc1, 0xff, 0x80, 0xff, 0x80, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x80,
+	0xff, 0x00, 0x00, 0x00, 0x07, 0xc0, 0xff, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x7f, 0x80,
+	0xfc, 0x00, 0x00, 0x3c, 0x07, 0xc0, 0x3f, 0x80, 0xfc, 0x00, 0x01, 0xff, 0xc7, 0xc0, 0x1f, 0x80,
+	0xf8, 0x00, 0x07, 0xff, 0xf7, 0xc0, 0x1f, 0x80, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x0f, 0x80,
+	0xf0, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x0f, 0x80, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x0f, 0x80,
+	0xf0, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x07, 0x80, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x07, 0x80,
+	0xe0, 0x00, 0xff, 0x81, 0xff, 0xc0, 0x07, 0x80, 0xe0, 0x01, 0xff, 0x00, 0x7f, 0xc0, 0x07, 0x80,
+	0xe0, 0x01, 0xfe, 0x00, 0x3f, 0xc0, 0x03, 0x80, 0xe0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0x80,
+	0xe0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x03, 0x80, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x03, 0x80,
+	0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x03, 0x80, 0xc0, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x03, 0x80,
+	0xe0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0x80, 0xe0, 0x01, 0xfc, 0x00, 0x3f, 0xc0, 0x03, 0x80,
+	0xe0, 0x01, 0xfe, 0x00, 0x7f, 0x80, 0x03, 0x80, 0xe0, 0x01, 0xff, 0x00, 0xff, 0x80, 0x07, 0x80,
+	0xe0, 0x01, 0xff, 0xc3, 0xff, 0x80, 0x07, 0x80, 0xf0, 0x01, 0xff, 0xff, 0xff, 0x00, 0x07, 0x80,
+	0xf0, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x07, 0x80, 0xf0, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0x80,
+	0xf8, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0x80,
+	0xfc, 0x01, 0xf3, 0xff, 0xc0, 0x00, 0x1f, 0x80, 0xfc, 0x01, 0xf0, 0xff, 0x00, 0x00, 0x3f, 0x80,
+	0xfe, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x3f, 0x80, 0xfe, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0x80,
+	0xff, 0x01, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x81, 0xf0, 0x00, 0x00, 0x01, 0xff, 0x80,
+	0xff, 0xc1, 0xf0, 0x00, 0x00, 0x03, 0xff, 0x80, 0xff, 0xe1, 0xf0, 0x00, 0x00, 0x03, 0xff, 0x80,
+	0xff, 0xf1, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x80,
+	0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0x80, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80
+};
+
+// 'logo', 57x60px, page-major RLE: 187 bytes (raw 480 bytes)
+const unsigned char logo_rle [] = {
+	0x8E, 0xFF, 0x80, 0x7F, 0x81, 0x3F, 0x8C, 0x1F, 0x80, 0x3F, 0x99, 0xFF, 0x02, 0x7F, 0x3F, 0x0F,
+	0x80, 0x07, 0x01, 0x03, 0x01, 0x95, 0x00, 0x83, 0xFF, 0x00, 0x01, 0x80, 0x03, 0x03, 0x07, 0x0F,
+	0x1F, 0x7F, 0x89, 0xFF, 0x02, 0x7F, 0x0F, 0x03, 0x88, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xF0, 0xF8,
+	0x80, 0xFC, 0x81, 0xFE, 0x82, 0xFF, 0x82, 0xFE, 0x80, 0xFC, 0x00, 0xF8, 0x83, 0xFF, 0x86, 0x00,
+	0x02, 0x01, 0x07, 0x3F, 0x84, 0xFF, 0x00, 0x1F, 0x8A, 0x00, 0x00, 0xFE, 0x84, 0xFF, 0x02, 0x07,
+	0x03, 0x01, 0x84, 0x00, 0x80, 0x01, 0x01, 0x03, 0x0F, 0x85, 0xFF, 0x89, 0x00, 0x00, 0x03, 0x84,
+	0xFF, 0x00, 0xE0, 0x89, 0x00, 0x85, 0xFF, 0x01, 0xFC, 0xF8, 0x80, 0xF0, 0x82, 0xE0, 0x80, 0xF0,
+	0x01, 0xF8, 0xFC, 0x82, 0xFF, 0x03, 0x7F, 0x3F, 0x1F, 0x03, 0x88, 0x00, 0x01, 0x80, 0xF8, 0x86,
+	0xFF, 0x03, 0xFC, 0xF0, 0xC0, 0x80, 0x84, 0x00, 0x83, 0xFF, 0x80, 0x03, 0x80, 0x07, 0x86, 0x0F,
+	0x80, 0x07, 0x80, 0x03, 0x00, 0x01, 0x88, 0x00, 0x04, 0x80, 0xC0, 0xE0, 0xF8, 0xFE, 0x8D, 0xFF,
+	0x01, 0xFE, 0xFC, 0x81, 0xF8, 0x83, 0xFF, 0x81, 0x80, 0x88, 0x00, 0x82, 0x80, 0x80, 0xC0, 0x80,
+	0xE0, 0x80, 0xF0, 0x00, 0xF8, 0x80, 0xFC, 0x89, 0xFF, 0xB7, 0x0F,
+};
+
+#endif /* _BENCH_LOGO_H */
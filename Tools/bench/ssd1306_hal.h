@@ -0,0 +1,28 @@
+/**
+ ******************************************************************************
+ * @file    ssd1306_hal.h
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo header.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Host port used by the benchmarks, see bench_hal.c.
+ *
+ ******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BENCH_SSD1306_HAL_H
+#define _BENCH_SSD1306_HAL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "ssd1306_hal_template.h"
+
+/* Exported variables --------------------------------------------------------*/
+extern uint32_t bench_i2c_bytes; /*!< Bytes written to the bus since last reset */
+
+#endif /* _BENCH_SSD1306_HAL_H */
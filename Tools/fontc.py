@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+fontc.py - Font compiler. Builds FontPageDef_t tables for ssd1306_putc_page()
+and ssd1306_puts_page() from BDF bitmap fonts.
+
+Usage:
+    python3 Tools/fontc.py terminus-12.bdf --name Font_Terminus12 --format page \\
+        --scan main/*.c --chars "0123456789.-" -o fonts_terminus12.c
+
+    --format  page (fastest), packed (smallest) or rle, see fonttool.py
+    --scan    keeps only characters found in string literals of these files
+    --chars   characters that are always kept, e.g. digits printed at run time
+    --range   keeps a range of character codes, e.g. 32-126 (default when
+              neither --scan nor --chars is given)
+    --proportional
+              keeps the DWIDTH advance and inked box of every glyph instead of
+              a fixed cell, page or rle format only
+
+Sources are read as UTF-8, so accented characters used by the UI (ç, ã, ñ...)
+are picked up like any other. Characters are Unicode code points of the Basic
+Multilingual Plane (up to U+FFFF), which ssd1306_puts_page() decodes from UTF-8.
+
+A header declaring the font is written next to the C file, so the output only
+has to be added to the build. Fonts that do not store a contiguous range of
+characters carry a sorted character map, resolved at run time by
+FONTS_GetGlyphIndex().
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+import fonttool
+
+HEADER_TEMPLATE = """
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef {guard}
+#define {guard}
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+/* Exported variables --------------------------------------------------------*/
+
+/**
+ * @brief  {width} x {height} pixels font size structure, {count} glyphs
+ */
+extern FontPageDef_t {name};
+
+#endif /* {guard} */
+"""
+
+C_ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "\\": "\\", '"': '"', "'": "'", "0": "\0"}
+
+
+class BdfFont(fonttool.Font):
+    """Font built from a BDF file, glyphs stored as column lists."""
+
+    def columns(self, index):
+        return self.glyphs[index]
+
+
+def parse_bdf(path):
+    """Returns (width, height, ascent, {code: (dwidth, bbx, rows)})."""
+    width = height = ascent = None
+    glyphs = {}
+    code = bbx = dwidth = rows = None
+    in_bitmap = False
+
+    for line in open(path, encoding="latin-1"):
+        parts = line.split()
+        if not parts:
+            continue
+        key = parts[0]
+        if in_bitmap:
+            if key == "ENDCHAR":
+                in_bitmap = False
+                if code is not None and code >= 0:
+                    glyphs[code] = (dwidth, bbx, rows)
+            else:
+                rows.append(int(key, 16) << (4 * (8 - len(key))) if len(key) < 8 else int(key[:8], 16))
+            continue
+        if key == "FONTBOUNDINGBOX":
+            width, height = int(parts[1]), int(parts[2])
+            if ascent is None:
+                ascent = height + int(parts[4])
+        elif key == "FONT_ASCENT":
+            ascent = int(parts[1])
+        elif key == "STARTCHAR":
+            code, bbx, dwidth, rows = None, None, None, []
+        elif key == "ENCODING":
+            code = int(parts[1])
+        elif key == "DWIDTH":
+            dwidth = int(parts[1])
+        elif key == "BBX":
+            bbx = tuple(int(v) for v in parts[1:5])
+        elif key == "BITMAP":
+            in_bitmap = True
+    if width is None:
+        raise ValueError("%s: FONTBOUNDINGBOX missing" % path)
+    return width, height, ascent, glyphs
+
+
+def render_glyph(glyph, width, height, ascent):
+    """Places a BDF glyph inside the font cell, returns one integer per column."""
+    dwidth, (bw, bh, bx, by), rows = glyph
+    cols = [0] * width
+    top = ascent - (by + bh)
+    for r, bits in enumerate(rows):
+        y = top + r
+        if y < 0 or y >= height:
+            continue
+        for c in range(bw):
+            x = bx + c
+            if 0 <= x < width and bits & (0x80000000 >> c):
+                cols[x] |= 1 << y
+    return cols
+
+
+def scan_sources(patterns):
+    """Collects characters used by string and character literals."""
+    used = set()
+    for pattern in patterns:
+        for path in glob.glob(pattern, recursive=True):
+            text = open(path, encoding="utf-8", errors="replace").read()
+            text = re.sub(r"/\*.*?\*/|//[^\n]*", "", text, flags=re.S)
+            for m in re.finditer(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'', text):
+                used.update(unescape(m.group(1) if m.group(1) is not None else m.group(2)))
+    return used
+
+
+def unescape(literal):
+    out, i = [], 0
+    while i < len(literal):
+        ch = literal[i]
+        if ch == "\\" and i + 1 < len(literal):
+            nxt = literal[i + 1]
+            if nxt == "x":
+                m = re.match(r"[0-9A-Fa-f]+", literal[i + 2:])
+                out.append(chr(int(m.group(0), 16)) if m else "x")
+                i += 2 + (len(m.group(0)) if m else 0)
+                continue
+            out.append(C_ESCAPES.get(nxt, nxt))
+            i += 2
+            continue
+        out.append(ch)
+        i += 1
+    return out
+
+
+def parse_range(text):
+    first, _, last = text.partition("-")
+    return set(range(int(first, 0), int(last or first, 0) + 1))
+
+
+def select_codes(args, available):
+    codes = set()
+    if args.scan:
+        codes.update(ord(c) for c in scan_sources(args.scan))
+    if args.chars:
+        codes.update(ord(c) for c in args.chars)
+    for r in args.range or []:
+        codes.update(parse_range(r))
+    if not codes:
+        codes = parse_range("32-126")
+
+    codes = {c for c in codes if c >= 32}
+    missing = sorted(c for c in codes if c not in available)
+    if missing:
+        sys.stderr.write("warning: not in font: %s\n" % " ".join("U+%04X" % c for c in missing))
+    too_big = sorted(c for c in codes if c > 0xFFFF)
+    if too_big:
+        sys.stderr.write("warning: characters above U+FFFF skipped: %s\n" % " ".join("U+%04X" % c for c in too_big))
+    return sorted(c for c in codes if c in available and c <= 0xFFFF)
+
+
+def compile_font(args):
+    width, height, ascent, glyphs = parse_bdf(args.bdf)
+    codes = select_codes(args, glyphs)
+    if not codes:
+        raise ValueError("no glyph selected")
+    cell = max(width, max(glyphs[c][0] or 0 for c in codes))
+    columns = [render_glyph(glyphs[c], cell, height, ascent) for c in codes]
+    font = BdfFont(args.name, cell, height, columns, codes)
+    font.baseline = min(max(ascent, 0), height)
+
+    if args.proportional:
+        font.boxes = []
+        for c, cols in zip(codes, columns):
+            left, top, w, h, box = fonttool.trim_box(cols)
+            font.boxes.append((glyphs[c][0] or left + w, left, top, w, h, box))
+        font.width = max(max(b[0], b[1] + b[3]) for b in font.boxes)
+    return font
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("bdf", help="BDF font file")
+    parser.add_argument("--name", required=True, help="C name of the font, e.g. Font_Terminus12")
+    parser.add_argument("--format", choices=fonttool.FORMATS, default="page")
+    parser.add_argument("--scan", nargs="+", help="source files scanned for used characters")
+    parser.add_argument("--chars", help="characters always included")
+    parser.add_argument("--range", action="append", help="character code range, e.g. 32-126")
+    parser.add_argument("--proportional", action="store_true", help="per-glyph advance and inked box")
+    parser.add_argument("-o", "--output", required=True, help="output C file, a .h is written next to it")
+    args = parser.parse_args(argv)
+    if args.proportional and args.format not in fonttool.PROP_FORMATS:
+        parser.error("--proportional needs --format page or rle")
+
+    font = compile_font(args)
+    if font.height > 64 or font.width > 128:
+        raise ValueError("%s: %dx%d does not fit the display" % (font.name, font.width, font.height))
+
+    c_name = os.path.basename(args.output)
+    h_path = os.path.splitext(args.output)[0] + ".h"
+    h_name = os.path.basename(h_path)
+    notes = ["Source: %s" % os.path.basename(args.bdf),
+             "%d glyphs, %s%s format, %d bytes of flash" % (
+                 len(font.codes), "proportional " if args.proportional else "", args.format, fonttool.flash_size(font, args.format))]
+
+    text = fonttool.emit_source([font], args.format, c_name, "Tools/fontc.py", notes)
+    text = text.replace('#include "fonts.h"', '#include "%s"' % h_name)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as fp:
+        fp.write(text)
+
+    guard = "_" + re.sub(r"\W", "_", h_name).upper()
+    header = fonttool.FILE_HEADER.format(file=h_name, kind="header", tool="Tools/fontc.py", notes="")
+    header += HEADER_TEMPLATE.format(guard=guard, name=font.name, width=font.width,
+                                     height=font.height, count=len(font.codes))
+    with open(h_path, "w", encoding="utf-8", newline="\n") as fp:
+        fp.write(header)
+
+    print("\n".join(notes))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
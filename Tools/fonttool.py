@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+"""
+fonttool.py - Converts the FontDef_t tables of fonts.c to the FontPageDef_t
+formats understood by ssd1306_putc_page(). Also used by fontc.py.
+
+Usage:
+    python3 Tools/fonttool.py packed Library/ssd1306/src/fonts.c -o Library/ssd1306/src/fonts_packed.c
+    python3 Tools/fonttool.py rle    Library/ssd1306/src/fonts.c -o Library/ssd1306/src/fonts_rle.c
+    python3 Tools/fonttool.py prop   Library/ssd1306/src/fonts.c -o Library/ssd1306/src/fonts_prop.c
+    python3 Tools/fonttool.py page   Library/ssd1306/src/fonts.c -o fonts_page.c
+    python3 Tools/fonttool.py report Library/ssd1306/src/fonts.c
+
+Glyph formats (see FONTS_FORMAT_t in fonts.h):
+    page    ((height + 7) / 8) pages of width column bytes per glyph, LSB on top.
+    packed  Per glyph: first inked row, number of inked rows, first inked column
+            (high nibble) and inked columns - 1 (low nibble), followed by the
+            inked box stored column after column, LSB first, with no padding.
+            An index table holds the byte offset of every glyph. Packed fonts
+            are limited to 16 columns and 32 rows.
+    rle     Page format of each glyph compressed by rletool.rle_encode(), with
+            an index table holding the byte offset of every glyph.
+
+Proportional fonts (the prop command, or fontc.py --proportional) store only
+the inked box of every glyph, in page or rle format, and a FontGlyphDef_t
+table with its offset, advance and position inside the line. The prop command
+trims the monospace fonts of fonts.c: glyphs advance by their inked width plus
+one column and the space by half a cell.
+"""
+
+import argparse
+import re
+import sys
+
+import rletool
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+FORMATS = ("page", "packed", "rle")
+PROP_FORMATS = ("page", "rle")
+GLYPH_SPACING = 1
+
+FILE_HEADER = """/**
+ ******************************************************************************
+ * @file    {file}
+ * @author  Eng. Eletricista Andre L. A. Lopes
+ * @version V1.0.0
+ * @date    Segunda, 19 de outubro de 2026
+ * @brief   Arquivo {kind}.
+ ******************************************************************************
+ * @attention
+ *
+ * 					e-mail: andrelopes.al@gmail.com.
+ *
+ * Generated by {tool}, do not edit.
+ *
+{notes} ******************************************************************************
+ */
+"""
+
+
+class Font:
+    """Monospace bitmap font, one list of row bitmasks per glyph (bit 15 = left)."""
+
+    def __init__(self, name, width, height, glyphs, codes=None):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.glyphs = glyphs
+        self.codes = codes or list(range(FIRST_CHAR, FIRST_CHAR + len(glyphs)))
+        self.boxes = None
+        self.baseline = 0
+
+    @property
+    def first(self):
+        return self.codes[0]
+
+    @property
+    def last(self):
+        return self.codes[-1]
+
+    @property
+    def sparse(self):
+        return self.last - self.first + 1 != len(self.codes)
+
+    @property
+    def pages(self):
+        return (self.height + 7) // 8
+
+    def columns(self, index):
+        """Returns the glyph as one integer per column, bit n = row n."""
+        cols = [0] * self.width
+        for row, bits in enumerate(self.glyphs[index]):
+            for col in range(self.width):
+                if (bits << col) & 0x8000:
+                    cols[col] |= 1 << row
+        return cols
+
+
+def trim_box(cols):
+    """Returns (left, top, width, height, columns) of the inked box of a glyph."""
+    ink = 0
+    for c in cols:
+        ink |= c
+    if ink == 0:
+        return 0, 0, 0, 0, []
+    top = (ink & -ink).bit_length() - 1
+    inked = [i for i, c in enumerate(cols) if c]
+    left, right = inked[0], inked[-1]
+    return left, top, right - left + 1, ink.bit_length() - top, [c >> top for c in cols[left:right + 1]]
+
+
+def make_proportional(font):
+    """Trims a monospace font, glyphs advance by their inked width plus one column."""
+    boxes = []
+    for g in range(len(font.glyphs)):
+        left, top, width, height, cols = trim_box(font.columns(g))
+        advance = width + GLYPH_SPACING if width else (font.width + 1) // 2
+        boxes.append((advance, 0, top, width, height, cols))
+    if ord("H") in font.codes:
+        font.baseline = max(c.bit_length() for c in font.columns(font.codes.index(ord("H"))))
+    font.boxes = boxes
+    font.width = max(b[0] for b in boxes)
+    return font
+
+
+def parse_fonts_c(path):
+    """Reads the uint16_t tables and FontDef_t definitions of fonts.c."""
+    text = open(path, encoding="utf-8").read()
+    tables = {}
+    for m in re.finditer(r"const\s+uint16_t\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};", text, re.S):
+        body = re.sub(r"//.*", "", m.group(2))
+        tables[m.group(1)] = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+    fonts = []
+    for m in re.finditer(r"FontDef_t\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)\s*\}", text):
+        name, width, height, table = m.group(1), int(m.group(2)), int(m.group(3)), m.group(4)
+        rows = tables[table]
+        glyphs = [rows[i:i + height] for i in range(0, len(rows), height)]
+        fonts.append(Font(name, width, height, glyphs))
+    return fonts
+
+
+def encode_page_glyph(cols, pages):
+    data = bytearray()
+    for page in range(pages):
+        data.extend((c >> (page * 8)) & 0xFF for c in cols)
+    return data
+
+
+def encode_page(font):
+    data = bytearray()
+    for g in range(len(font.glyphs)):
+        data.extend(encode_page_glyph(font.columns(g), font.pages))
+    return data
+
+
+def pack_glyph(cols):
+    """Packs one glyph keeping only its inked box."""
+    ink = 0
+    for c in cols:
+        ink |= c
+    if ink == 0:
+        return bytearray([0, 0, 0])
+    top = (ink & -ink).bit_length() - 1
+    rows = ink.bit_length() - top
+    inked = [i for i, c in enumerate(cols) if c]
+    left, count = inked[0], inked[-1] - inked[0] + 1
+
+    stream, nbits = 0, 0
+    for c in cols[left:left + count]:
+        stream |= (c >> top) << nbits
+        nbits += rows
+    out = bytearray([top, rows, (left << 4) | (count - 1)])
+    out.extend(stream.to_bytes((nbits + 7) // 8, "little"))
+    return out
+
+
+def encode_indexed(font, fmt):
+    """Encodes a font in packed or rle format, returns (index, data)."""
+    if fmt == "packed" and (font.width > 16 or font.height > 32):
+        raise ValueError("%s: packed fonts are limited to 16 x 32 pixels" % font.name)
+    index, data = [], bytearray()
+    for g in range(len(font.glyphs)):
+        index.append(len(data))
+        cols = font.columns(g)
+        if fmt == "packed":
+            data.extend(pack_glyph(cols))
+        else:
+            page = encode_page_glyph(cols, font.pages)
+            packed = rletool.rle_encode(page)
+            assert rletool.rle_decode(packed, len(page)) == page
+            data.extend(packed)
+    if len(data) > 0xFFFF:
+        raise ValueError("%s: %s data exceeds 64 KB" % (font.name, fmt))
+    return index, data
+
+
+def encode_proportional(font, fmt):
+    """Encodes the inked boxes of a proportional font, returns (metrics, data)."""
+    if fmt not in PROP_FORMATS:
+        raise ValueError("%s: proportional fonts use the page or rle format" % font.name)
+    metrics, data = [], bytearray()
+    for advance, left, top, width, height, cols in font.boxes:
+        metrics.append((len(data), advance, left, top, width, height))
+        page = encode_page_glyph(cols, (height + 7) // 8)
+        data.extend(page if fmt == "page" else rletool.rle_encode(page))
+    if len(data) > 0xFFFF:
+        raise ValueError("%s: %s data exceeds 64 KB" % (font.name, fmt))
+    return metrics, data
+
+
+def flash_size(font, fmt):
+    """Bytes of flash used by glyph data, index and character map."""
+    size = len(font.codes) * 2 if font.sparse else 0
+    if font.boxes is not None:
+        metrics, data = encode_proportional(font, fmt)
+        return size + len(data) + len(metrics) * 8
+    if fmt == "page":
+        return size + len(encode_page(font))
+    index, data = encode_indexed(font, fmt)
+    return size + len(data) + len(index) * 2
+
+
+def report_lines(fonts):
+    lines = ["%-12s %8s %8s %8s %8s %8s" % ("font", "uint16", "page", "packed", "rle", "prop")]
+    for f in fonts:
+        packed = flash_size(f, "packed") if f.width <= 16 and f.height <= 32 else 0
+        prop = flash_size(make_proportional(Font(f.name, f.width, f.height, f.glyphs, f.codes)), "page")
+        lines.append("%-12s %8d %8d %8d %8d %8d" % (f.name, len(f.glyphs) * f.height * 2,
+                     flash_size(f, "page"), packed, flash_size(f, "rle"), prop))
+    return lines
+
+
+def c_bytes(data, indent="\t", per_line=16):
+    out = []
+    for i in range(0, len(data), per_line):
+        out.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(out)
+
+
+def c_words(data, indent="\t", per_line=12):
+    out = []
+    for i in range(0, len(data), per_line):
+        out.append(indent + ", ".join("0x%04X" % w for w in data[i:i + per_line]) + ",")
+    return "\n".join(out)
+
+
+def emit_font(font, fmt, name):
+    """Returns the C tables and FontPageDef_t definition of one font."""
+    out = []
+    index_name = char_map = glyphs_name = "NULL"
+    if font.boxes is not None:
+        metrics, data = encode_proportional(font, fmt)
+        glyphs_name = "%s_Glyphs" % name
+        rows = ["\t{ %d, %d, %d, %d, %d, %d }," % m for m in metrics]
+        out.append("static const FontGlyphDef_t %s[] = {\n%s\n};\n" % (glyphs_name, "\n".join(rows)))
+    elif fmt == "page":
+        data = encode_page(font)
+    else:
+        index, data = encode_indexed(font, fmt)
+        index_name = "%s_Index" % name
+        out.append("static const uint16_t %s[] = {\n%s\n};\n" % (index_name, c_words(index)))
+    out.append("static const uint8_t %s_Data[] = {\n%s\n};\n" % (name, c_bytes(data)))
+    if font.sparse:
+        char_map = "%s_CharMap" % name
+        out.append("static const uint16_t %s[] = {\n%s\n};\n" % (char_map, c_words(font.codes)))
+
+    out.append("FontPageDef_t %s = {" % name)
+    out.append("\t%d,\n\t%d,\n\t%d,\n\t%d," % (font.width, font.height, font.first, font.last))
+    out.append("\t%s_Data,\n\tFONTS_FORMAT_%s,\n\t%s,\n\t%s,\n\t%d,\n\t%s,\n\t%d\n};\n" % (
+        name, fmt.upper(), index_name, char_map, len(font.codes), glyphs_name, font.baseline))
+    return "\n".join(out)
+
+
+def emit_source(fonts, fmt, file_name, tool, notes, suffix=""):
+    notes = "".join(" * %s\n" % line for line in notes) + " *\n" if notes else ""
+    out = [FILE_HEADER.format(file=file_name, kind="source", tool=tool, notes=notes)]
+    out.append('/* Includes ------------------------------------------------------------------*/')
+    out.append('#include "fonts.h"\n')
+    out.append('/* Private variables ---------------------------------------------------------*/')
+    for f in fonts:
+        out.append(emit_font(f, fmt, f.name + suffix))
+    return "\n".join(out)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("command", choices=FORMATS + ("prop", "report"))
+    parser.add_argument("fonts_c", help="path to fonts.c")
+    parser.add_argument("-o", "--output", help="output C file")
+    args = parser.parse_args(argv)
+
+    fonts = parse_fonts_c(args.fonts_c)
+    report = report_lines(fonts)
+    if args.command == "report":
+        print("\n".join(report))
+        return 0
+
+    if not args.output:
+        parser.error("%s needs --output" % args.command)
+    name = args.output.replace("\\", "/").split("/")[-1]
+    suffix = "_" + args.command.capitalize()
+    fmt = args.command
+    if fmt == "prop":
+        fonts = [make_proportional(f) for f in fonts]
+        fmt = "page"
+    text = emit_source(fonts, fmt, name, "Tools/fonttool.py", ["Flash usage in bytes:"] + report, suffix)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as fp:
+        fp.write(text)
+    print("\n".join(report))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+rletool.py - Run-length encodes bitmaps for the streaming decoder of
+ssd1306_draw_bitmap_rle(). Fonts are encoded with "fonttool.py rle".
+
+Usage:
+    python3 Tools/rletool.py Examples/esp32/main/main.c --name logo --width 57 --height 60 [-o logo_rle.h]
+
+Assets are first laid out page-major (((height + 7) / 8) pages of width column
+bytes, LSB on top), then compressed with this byte oriented RLE:
+    0x00..0x7F  n + 1 literal bytes follow
+    0x80..0xFF  the next byte is repeated (n & 0x7F) + 2 times
+Runs may cross page boundaries; the decoder stops after width * pages bytes.
+"""
+
+import argparse
+import re
+import sys
+
+
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+
+
+def rle_encode(data):
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:MAX_LITERAL]
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < MAX_REPEAT:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 2))
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def rle_decode(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            out.extend([data[i]] * ((c & 0x7F) + 2))
+            i += 1
+        else:
+            out.extend(data[i:i + c + 1])
+            i += c + 1
+    return out
+
+
+def bitmap_to_page(bitmap, width, height):
+    """Converts a row-major bitmap (ssd1306_draw_bitmap layout) to page-major bytes."""
+    stride = (width + 7) // 8
+    pages = (height + 7) // 8
+    out = bytearray(width * pages)
+    for y in range(height):
+        for x in range(width):
+            if bitmap[y * stride + x // 8] & (0x80 >> (x % 8)):
+                out[(y // 8) * width + x] |= 1 << (y % 8)
+    return out
+
+
+def parse_c_array(path, name):
+    text = open(path, encoding="utf-8").read()
+    m = re.search(r"\b%s\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        raise ValueError("array %s not found in %s" % (name, path))
+    body = re.sub(r"//.*", "", m.group(1))
+    return bytearray(int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\b\d+\b", body))
+
+
+def emit_bitmap(name, width, height, raw, data):
+    out = ["// '%s', %dx%dpx, page-major RLE: %d bytes (raw %d bytes)" % (name, width, height, len(data), len(raw))]
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    out.append("const unsigned char %s_rle [] = {\n%s\n};\n" % (name, "\n".join(rows)))
+    return "\n".join(out)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="C file holding the bitmap array")
+    parser.add_argument("-o", "--output", help="output file, stdout when omitted")
+    parser.add_argument("--name", required=True, help="bitmap array name")
+    parser.add_argument("--width", type=int, required=True, help="bitmap width in pixels")
+    parser.add_argument("--height", type=int, required=True, help="bitmap height in pixels")
+    args = parser.parse_args(argv)
+
+    raw = parse_c_array(args.source, args.name)
+    data = rle_encode(bitmap_to_page(raw, args.width, args.height))
+    text = emit_bitmap(args.name, args.width, args.height, raw, data)
+    sys.stderr.write("%s: %d -> %d bytes\n" % (args.name, len(raw), len(data)))
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8", newline="\n") as fp:
+            fp.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())